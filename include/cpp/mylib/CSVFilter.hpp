@@ -0,0 +1,72 @@
+#ifndef CSV_FILTER_HPP
+#define CSV_FILTER_HPP
+
+#include <string>
+#include <string_view>
+
+namespace mylib {
+
+/**
+ * @brief 비교 연산자
+ */
+enum class CompareOp {
+    Equal,         /**< == */
+    NotEqual,      /**< != */
+    Less,          /**< <  */
+    LessEqual,     /**< <= */
+    Greater,       /**< >  */
+    GreaterEqual   /**< >= */
+};
+
+/**
+ * @brief 파싱 중 행을 거르는 조건 (열 op 값)
+ *
+ * 숫자 값으로 만들면 셀을 숫자로 읽어 비교하고 (숫자가 아닌 셀은 불일치),
+ * 문자열 값으로 만들면 바이트 순서로 비교합니다.
+ *
+ * @example
+ * CSVPredicate("city", CompareOp::Equal, "Seoul");
+ * CSVPredicate("score", CompareOp::Greater, 90);
+ */
+class CSVPredicate {
+private:
+    std::string column_;
+    CompareOp op_;
+    std::string text_;
+    double number_;
+    bool numeric_;
+
+public:
+    /**
+     * @brief 문자열 비교 조건을 만듭니다
+     * @param column 비교할 열 이름
+     * @param op 비교 연산자
+     * @param value 비교할 문자열
+     */
+    CSVPredicate(std::string column, CompareOp op, std::string value);
+
+    /**
+     * @brief 숫자 비교 조건을 만듭니다
+     * @param column 비교할 열 이름
+     * @param op 비교 연산자
+     * @param value 비교할 숫자
+     */
+    CSVPredicate(std::string column, CompareOp op, double value);
+
+    /**
+     * @brief 셀이 조건을 만족하는지 확인합니다
+     * @param cell 복원된 셀 값
+     * @return 만족하면 true
+     */
+    bool matches(std::string_view cell) const;
+
+    /**
+     * @brief 비교할 열 이름을 반환합니다
+     * @return 열 이름
+     */
+    const std::string& column() const;
+};
+
+} // namespace mylib
+
+#endif // CSV_FILTER_HPP
@@ -0,0 +1,69 @@
+#ifndef CSV_NUMBER_HPP
+#define CSV_NUMBER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace mylib {
+
+/**
+ * 셀 숫자 파싱 커널
+ *
+ * 타입 변환(convertColumn(), infer_types), 숫자 필터, sortFile()이 함께 씁니다.
+ * 받아들이는 형식과 결과는 셀 전체에 std::from_chars를 쓴 것과 같습니다
+ * (앞뒤 공백과 '+' 부호는 받지 않고, 범위를 넘는 값은 실패).
+ * 흔한 형식만 빠른 경로로 읽고 나머지는 std::from_chars에 넘기므로 실수도 strtod와 비트 단위로 같습니다.
+ */
+
+/**
+ * @brief 셀 전체를 정수로 읽습니다
+ * @param text 셀 값
+ * @param value 결과 (실패하면 바꾸지 않음)
+ * @return 셀 전체가 int64 범위의 정수이면 true
+ *
+ * @note 숫자는 8자리씩 SWAR(64비트 정수 하나에 8바이트)로 검사하고 변환합니다
+ */
+bool parseInt64(std::string_view text, int64_t& value);
+
+/**
+ * @brief 셀 전체를 실수로 읽습니다
+ * @param text 셀 값 (`-12.5`, `.5`, `1e-3`, `inf`, `nan` 등)
+ * @param value 결과 (실패하면 바꾸지 않음)
+ * @return 셀 전체가 실수이고 double 범위 안이면 true
+ *
+ * @note 유효 숫자가 19자리 이하이고 가수가 2^53 이하, 10의 지수가 ±22 이내이면
+ *       정확한 double 곱셈/나눗셈 한 번으로 계산합니다 (Clinger 빠른 경로, 반올림 한 번).
+ *       유효 숫자가 19자리 이하인 나머지 정규 수는 가수와 128비트 5의 거듭제곱 근사를 곱해
+ *       반올림을 정합니다 (Eisel–Lemire). 자릿수가 더 많거나, 비정규 수·범위 밖이거나,
+ *       근사로 반올림을 정할 수 없는 값은 std::from_chars로 읽습니다.
+ */
+bool parseDouble(std::string_view text, double& value);
+
+/**
+ * @brief 여러 셀을 정수로 읽습니다
+ * @param cells 셀 배열
+ * @param count 셀 개수
+ * @param out 결과 배열 (count개)
+ * @return 앞에서부터 성공한 셀 개수 (모두 성공하면 count, 아니면 처음 실패한 셀의 인덱스)
+ */
+size_t parseInt64s(const std::string_view* cells, size_t count, int64_t* out);
+
+/**
+ * @brief 여러 셀을 실수로 읽습니다
+ * @param cells 셀 배열
+ * @param count 셀 개수
+ * @param out 결과 배열 (count개)
+ * @return 앞에서부터 성공한 셀 개수 (모두 성공하면 count, 아니면 처음 실패한 셀의 인덱스)
+ *
+ * @example
+ * CSVReader reader("scores.csv", {"score"});
+ * std::vector<std::string_view> cells;   // 한 묶음의 셀 뷰
+ * std::vector<double> scores(cells.size());
+ * if (parseDoubles(cells.data(), cells.size(), scores.data()) != cells.size()) { ... }
+ */
+size_t parseDoubles(const std::string_view* cells, size_t count, double* out);
+
+} // namespace mylib
+
+#endif // CSV_NUMBER_HPP
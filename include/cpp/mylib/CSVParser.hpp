@@ -2,29 +2,214 @@
 #define CSV_PARSER_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <memory>
+#include <functional>
 #include <stdexcept>
 #include <cstddef>
+#include <cstdint>
+#include "cpp/mylib/CSVFilter.hpp"
+#include "cpp/mylib/CSVTable.hpp"
+#include "cpp/mylib/CSVWriter.hpp"
 
 namespace mylib {
 
+class MappedFile;
+class FileReader;
+
+namespace detail {
+class LazyRows;
+}
+
+/**
+ * @brief CSV 파싱 모드
+ */
+enum class ParseMode {
+    Copy,    /**< 셀을 열별 버퍼로 복사하여 저장 (기본값) */
+    Mapped,  /**< 파일을 메모리 매핑하고 셀은 매핑을 가리키는 오프셋으로 저장 (zero-copy) */
+    Lazy     /**< 레코드 시작 위치만 색인하고 행은 처음 접근할 때 토큰화 (열기 = 줄바꿈 스캔 한 번) */
+};
+
+/**
+ * @brief CSV 파싱 옵션
+ */
+struct ParseOptions {
+    ParseMode mode = ParseMode::Copy;  /**< 셀 저장 방식 */
+    size_t threads = 1;                /**< 파싱 스레드 수 (0이면 CPU 코어 수) */
+    bool infer_types = false;          /**< 파싱 후 열 타입을 추론하여 숫자 열을 변환 */
+    size_t infer_sample_rows = 1000;   /**< 타입 추론에 쓸 표본 행 수 (0이면 전체) */
+    std::vector<std::string> columns;  /**< 읽을 열 이름 (비어 있으면 전체, 지정하면 이 순서로 저장) */
+    std::vector<CSVPredicate> filters; /**< 행 조건 (모두 만족하는 행만 저장, 프로젝션 밖의 열도 가능) */
+    size_t dictionary_max_distinct = 0; /**< 서로 다른 값이 이 개수 이하인 문자열 열을 사전 인코딩 (0이면 끔) */
+    size_t lazy_cache_rows = 4096;     /**< Lazy 모드에서 토큰화한 행을 보관할 최대 개수 (최소 1) */
+    bool use_row_index = true;         /**< Lazy 모드에서 지문이 맞는 사이드카 색인(buildIndex())이 있으면 스캔 대신 사용 */
+};
+
+/**
+ * @brief 메모리 한도를 넘는 파일의 정렬/집계 옵션 (sortFile(), groupByFile())
+ */
+struct SpillOptions {
+    size_t memory_budget = 256 * 1024 * 1024;  /**< 한 번에 메모리에 올릴 대략의 바이트 수 (최소 1 MiB로 봄) */
+    std::string temp_dir;              /**< 넘친 데이터를 둘 디렉터리 (비어 있으면 시스템 임시 디렉터리) */
+    bool infer_types = false;          /**< 정렬 키 열 타입을 파일 전체로 추론 (끄면 문자열로 비교) */
+    size_t threads = 1;                /**< 묶음 정렬/집계 스레드 수 (0이면 CPU 코어 수) */
+};
+
+/**
+ * @brief sortFile()/groupByFile() 실행 통계
+ */
+struct SpillStats {
+    size_t rows = 0;              /**< 읽은 데이터 행 수 */
+    size_t chunks = 0;            /**< 메모리 한도로 나눈 묶음 수 (1이면 디스크를 쓰지 않음) */
+    size_t merge_passes = 0;      /**< 정렬 구간을 병합한 횟수 (마지막 병합 포함) */
+    uint64_t spilled_bytes = 0;   /**< 임시 파일에 쓴 바이트 수 */
+};
+
+/**
+ * @brief refresh() 결과
+ */
+struct RefreshResult {
+    size_t rows = 0;        /**< 새로 추가된 행 수 (reloaded면 다시 읽은 전체 행 수) */
+    bool reloaded = false;  /**< 파일이 교체되거나 잘려서 처음부터 다시 읽었는지 */
+};
+
 /**
  * @brief CSV 파서 클래스
  *
  * CSV 파일을 읽고 쓰는 기능을 제공합니다.
- * std::string과 std::vector를 사용하여 자동 메모리 관리를 제공합니다.
+ * 데이터는 열 우선 CSVTable에 보관하므로 한 열을 훑을 때 연속 메모리를 읽습니다.
+ *
+ * ParseMode::Mapped로 파싱하면 셀을 복사하지 않고 매핑된 파일을 가리키는
+ * 오프셋으로 보관합니다. 매핑은 파서(및 그 복사본)가 살아있는 동안 유지됩니다.
+ *
+ * ParseMode::Lazy로 파싱하면 테이블을 만들지 않고 레코드 시작 위치만 색인합니다.
+ * get()/getView()/getRow()/getRowView()는 그 행만 토큰화하며, 열 단위 기능
+ * (column(), aggregate(), groupBy(), sortBy() 등)은 materialize()로 전체를 파싱한 뒤 쓸 수 있습니다.
+ *
+ * @note 모든 행은 헤더 개수에 맞춰집니다 (짧은 행은 빈 셀로 채움, 긴 행은 잘림)
  */
 class CSVParser {
 private:
-    std::vector<std::string> headers_;
-    std::vector<std::vector<std::string>> rows_;
+    CSVTable table_;
+
+    // Mapped 모드: table_의 열이 빌려 쓰는 매핑
+    std::shared_ptr<const MappedFile> mapping_;
+
+    // follow() 상태: 이어 읽을 파일과 지금까지 소비한 바이트
+    struct FollowState {
+        bool active = false;
+        std::string filename;
+        ParseOptions options;
+        std::vector<std::string> headers;  // 원본 헤더 (비어 있으면 아직 헤더 줄을 읽지 못함)
+        uint64_t device = 0;
+        uint64_t inode = 0;
+        uint64_t offset = 0;               // 다음에 읽을 바이트 위치 (완성된 레코드 뒤)
+    };
+    FollowState follow_;
+
+    // Lazy 모드: 행 위치 색인과 행 캐시 (nullptr이면 table_ 사용)
+    std::shared_ptr<const detail::LazyRows> lazy_;
+
+    void parseChunked(const std::string& filename, const ParseOptions& options);
+    void finishColumns(const ParseOptions& options);
+    const CSVTable& loaded() const;
+    CSVTable& loaded();
+    size_t consumeAppended(const FileReader& file);
 
 public:
+    /**
+     * @brief forEachRow() 콜백 타입 - false를 반환하면 읽기를 중단합니다
+     */
+    using RowCallback = std::function<bool(const std::vector<std::string_view>& row)>;
+
     /**
      * @brief 기본 생성자
      */
     CSVParser() = default;
 
+    /**
+     * @brief 파일 전체를 올리지 않고 데이터 행을 하나씩 콜백으로 전달합니다
+     * @param filename 읽을 CSV 파일 경로
+     * @param callback 행마다 호출할 함수 (행 뷰는 콜백이 반환되면 무효화됨)
+     * @return 콜백에 전달한 행 개수
+     * @throws std::runtime_error 파일을 열거나 읽을 수 없을 때
+     *
+     * @note 메모리 사용량은 가장 긴 행의 길이에 비례합니다 (CSVReader 사용)
+     */
+    static size_t forEachRow(const std::string& filename, const RowCallback& callback);
+
+    /**
+     * @brief 임의 접근용 행 위치 사이드카 색인을 만듭니다
+     * @param filename 색인할 CSV 파일 경로 (색인은 filename + ".idx"에 저장)
+     * @param stride 오프셋을 저장할 행 간격 (색인 크기 = 행 수 / stride × 8바이트)
+     * @param threads 스캔 스레드 수 (0이면 CPU 코어 수)
+     * @throws std::runtime_error 파일을 읽거나 색인을 쓸 수 없을 때
+     * @throws std::invalid_argument stride가 0일 때
+     *
+     * @note 색인에는 원본의 크기와 수정 시각을 함께 저장합니다. 이후 Lazy 모드로 열면
+     *       지문이 맞을 때 파일을 스캔하지 않고 색인만 읽으며, get(row, col)은
+     *       가까운 앞 색인 행부터 많아야 stride - 1개 레코드만 건너뜁니다.
+     *       원본이 바뀌었으면 색인을 무시하고 전체를 스캔합니다 (색인은 다시 만들어야 함).
+     *       stride가 작을수록 행 접근이 빨라지고 색인이 커집니다.
+     *
+     * @example
+     * CSVParser::buildIndex("huge.csv");          // huge.csv.idx
+     * ParseOptions options;
+     * options.mode = ParseMode::Lazy;
+     * parser.parse("huge.csv", options);          // 색인만 읽음
+     * std::string value = parser.get(123456789, 2);
+     */
+    static void buildIndex(const std::string& filename, size_t stride = 1024, size_t threads = 0);
+
+    /**
+     * @brief 메모리 한도 안에서 파일을 정렬해 다른 파일로 씁니다 (외부 정렬)
+     * @param input 읽을 CSV 파일 경로
+     * @param output 정렬 결과를 쓸 CSV 파일 경로 (헤더 포함, input과 달라야 함)
+     * @param keys 정렬 키들 (CSVTable::sortOrder()와 같은 순서 규칙, 안정 정렬)
+     * @param options 메모리 한도, 임시 디렉터리, 타입 추론, 스레드 수
+     * @return 실행 통계
+     * @throws std::runtime_error 파일을 읽거나 쓸 수 없거나, 열이 없을 때
+     *
+     * @note 파일을 memory_budget만큼씩 읽어 묶음마다 메모리에서 정렬합니다. 묶음이 하나뿐이면
+     *       그대로 output에 쓰고, 여러 개면 정렬된 구간 파일을 임시 디렉터리에 쓴 뒤 k-way 병합합니다.
+     *       구간마다 미리 읽기 스트림(1 MiB 블록 × 4)을 쓰므로 한 번에 병합하는 구간 수는
+     *       memory_budget에 맞추고, 그보다 많으면 여러 번에 나누어 병합합니다.
+     * @note infer_types이면 키 타입은 메모리 안 infer()와 같습니다. 첫 묶음으로 추론하고, 나중 묶음의
+     *       정수 키에 실수가 섞이면 Double로 넓히며, 숫자가 아닌 값이 나오면 문자열 비교로 바꾸고
+     *       이미 쓴 구간을 다시 정렬합니다. 결과에는 입력의 원래 텍스트를 그대로 씁니다.
+     * @note 임시 파일은 성공하든 예외가 나든 지웁니다
+     *
+     * @example
+     * SpillOptions options;
+     * options.memory_budget = 512 * 1024 * 1024;
+     * CSVParser::sortFile("2024-01.csv", "sorted.csv", {{"customer"}, {"amount", SortOrder::Descending}}, options);
+     */
+    static SpillStats sortFile(const std::string& input, const std::string& output,
+                               const std::vector<SortKey>& keys, const SpillOptions& options = SpillOptions());
+
+    /**
+     * @brief 메모리 한도 안에서 파일을 키 열로 묶어 집계합니다 (외부 GROUP BY)
+     * @param input 읽을 CSV 파일 경로
+     * @param keys 묶을 키 열 이름들 (하나 이상)
+     * @param aggregates 그룹마다 구할 집계들
+     * @param options 메모리 한도, 임시 디렉터리, 타입 추론, 스레드 수
+     * @param stats 실행 통계를 받을 포인터 (nullptr 가능)
+     * @return CSVTable::groupBy()와 같은 형식의 테이블 (그룹은 처음 나온 순서)
+     * @throws std::invalid_argument 키가 비어 있을 때
+     * @throws std::runtime_error 파일을 읽을 수 없거나, 열이 없거나, Sum/Min/Max/Mean 대상 열에
+     *         숫자가 아닌 값이 있을 때
+     *
+     * @note 키와 집계 열만 읽습니다. 묶음마다 부분 집계(합계/최솟값/최댓값/개수)를 구해 모으고,
+     *       모은 부분 집계가 한도의 절반을 넘으면 다시 합치며, 그래도 넘으면 키 해시로 나눈
+     *       임시 파일들에 내보낸 뒤 파일마다 합칩니다. 결과(그룹 수)는 메모리에 들어가야 합니다.
+     * @note 키는 항상 텍스트로 비교하고 (infer_types이면 결과의 키 열 타입을 추론),
+     *       집계 대상 열은 묶음마다 Int64로, 안 되면 Double로 변환합니다
+     */
+    static CSVTable groupByFile(const std::string& input, const std::vector<std::string>& keys,
+                                const std::vector<GroupAggregate>& aggregates,
+                                const SpillOptions& options = SpillOptions(), SpillStats* stats = nullptr);
+
     /**
      * @brief CSV 파일을 파싱합니다
      * @param filename 읽을 CSV 파일 경로
@@ -34,6 +219,110 @@ public:
      */
     void parse(const std::string& filename);
 
+    /**
+     * @brief 지정한 모드로 CSV 파일을 파싱합니다
+     * @param filename 읽을 CSV 파일 경로
+     * @param mode 파싱 모드 (Copy 또는 Mapped)
+     * @throws std::runtime_error 파일을 열거나 매핑할 수 없을 때
+     *
+     * @note Mapped 모드에서는 셀을 복사하지 않으므로 대용량 파일에서
+     *       할당 횟수와 메모리 사용량이 크게 줄어듭니다
+     */
+    void parse(const std::string& filename, ParseMode mode);
+
+    /**
+     * @brief 지정한 열만 파싱합니다 (프로젝션)
+     * @param filename 읽을 CSV 파일 경로
+     * @param columns 읽을 열 이름 (결과 테이블의 열 순서)
+     * @throws std::runtime_error 파일을 열 수 없거나 열 이름을 찾지 못했을 때
+     *
+     * @note 빠진 열의 필드는 구분자 위치만 찾고 복원/복사하지 않으므로
+     *       메모리와 시간이 파일 너비가 아니라 선택한 열 수에 비례합니다
+     *
+     * @example
+     * parser.parse("data.csv", {"name", "score"});
+     */
+    void parse(const std::string& filename, const std::vector<std::string>& columns);
+
+    /**
+     * @brief 옵션을 지정하여 CSV 파일을 파싱합니다
+     * @param filename 읽을 CSV 파일 경로
+     * @param options 파싱 옵션 (모드, 스레드 수)
+     * @throws std::runtime_error 파일을 열거나 매핑할 수 없을 때
+     *
+     * @note threads가 1이 아니면 파일을 바이트 구간으로 나누어 스레드 풀에서 파싱합니다.
+     *       구간 경계는 따옴표 상태를 고려해 레코드 시작으로 맞추며,
+     *       결과 행 순서는 단일 스레드 파싱과 같습니다.
+     * @note filters를 지정하면 토큰화하면서 조건 열을 먼저 복원해 평가하고,
+     *       실패한 행의 나머지 필드는 복원하거나 저장하지 않습니다
+     * @note infer_types가 true이면 숫자 열을 한 번만 변환해 두므로
+     *       getInt()/getDouble()/column<T>()가 텍스트를 다시 파싱하지 않습니다.
+     * @note dictionary_max_distinct를 지정하면 타입 추론 뒤 남은 문자열 열 중 서로 다른 값이
+     *       그 이하인 열을 사전 인코딩합니다 (CSVTable::Column::encodeDictionary() 참고).
+     *       Mapped 모드에서도 인코딩한 열은 매핑 대신 자체 사전을 가리킵니다.
+     * @note mode가 Lazy이면 헤더를 읽고 따옴표 밖 줄바꿈 위치만 SIMD로 색인합니다 (threads개 구간 병렬).
+     *       buildIndex()로 만든 사이드카 색인이 있고 원본과 지문이 맞으면 스캔하지 않습니다.
+     *       columns는 행을 토큰화할 때 적용하고, infer_types/dictionary_max_distinct는 materialize() 때 적용합니다.
+     * @throws std::invalid_argument mode가 Lazy인데 filters를 지정했을 때 (조건을 보려면 모든 행을 읽어야 함)
+     */
+    void parse(const std::string& filename, const ParseOptions& options);
+
+    /**
+     * @brief 여러 CSV 파일을 읽어 하나의 테이블로 이어 붙입니다
+     * @param paths 읽을 파일 경로들 (이 순서대로 행이 붙음)
+     * @param options 파싱 옵션 (mode는 무시하고 항상 셀을 복사, threads는 파일 단위 병렬)
+     * @throws std::runtime_error 파일을 읽을 수 없거나, 프로젝션 열이 없거나,
+     *         프로젝션 없이 헤더가 다른 파일이 섞였을 때
+     *
+     * @note Linux에서 io_uring을 쓸 수 있으면 파일 64개씩 열기/읽기/닫기를 묶어 제출하고,
+     *       아니면 파일마다 일반 읽기로 대체합니다 (mylib/csv_read_files.h)
+     * @note columns를 지정하면 파일마다 헤더에서 열을 찾으므로 열 순서가 달라도 됩니다
+     * @note 헤더 줄도 없는 빈 파일은 건너뜁니다
+     *
+     * @example
+     * parser.parseMany({"2024-01.csv", "2024-02.csv"});
+     */
+    void parseMany(const std::vector<std::string>& paths, const ParseOptions& options = ParseOptions());
+
+    /**
+     * @brief 계속 덧붙여지는 파일을 이어 읽기 시작합니다 (tail -f)
+     * @param filename 읽을 CSV 파일 경로
+     * @param options 파싱 옵션 (mode는 무시하고 항상 셀을 복사)
+     * @throws std::runtime_error 파일을 열 수 없을 때
+     *
+     * @note 줄바꿈("\n", "\r", "\r\n")으로 끝난 완성된 레코드까지만 읽고 그 위치를 기억합니다.
+     *       쓰는 중인 마지막 줄은 다음 refresh()에서 읽고, 파일이 "\r"로 끝나면 ("\r\n"일 수 있으므로)
+     *       그 레코드는 다음 바이트가 덧붙은 뒤 읽습니다.
+     * @note 파일을 매핑하지 않고 기억한 위치 뒤만 pread로 읽으므로, 읽는 중 copytruncate로
+     *       잘려도 SIGBUS 없이 다음 refresh()에서 처음부터 다시 읽습니다.
+     *
+     * @example
+     * parser.follow("access.csv");
+     * while (running) {
+     *     parser.refresh();
+     * }
+     */
+    void follow(const std::string& filename, const ParseOptions& options = ParseOptions());
+
+    /**
+     * @brief follow() 이후 새로 덧붙은 레코드만 읽어 테이블 뒤에 추가합니다
+     * @return 추가된 행 수와 다시 읽었는지 여부
+     * @throws std::logic_error follow() 중이 아닐 때
+     * @throws std::runtime_error 파일을 열 수 없을 때 (테이블은 그대로)
+     *
+     * @note 비용은 새로 덧붙은 바이트에 비례합니다 (파일을 매핑해도 앞부분 페이지는 건드리지 않음)
+     * @note 같은 경로의 파일이 교체(inode 변경)되거나 기억한 위치보다 작아지면(잘림)
+     *       처음부터 다시 읽습니다
+     * @note 숫자로 변환된 열은 새 행도 같은 타입으로 변환하며, 실패하면 문자열 열로 넓힙니다
+     */
+    RefreshResult refresh();
+
+    /**
+     * @brief follow() 중인지 확인합니다
+     * @return 이어 읽는 중이면 true (parse()/loadSnapshot()을 부르면 false가 됨)
+     */
+    bool isFollowing() const;
+
     /**
      * @brief 특정 셀의 값을 가져옵니다
      * @param row 행 인덱스 (0부터 시작)
@@ -43,6 +332,19 @@ public:
      */
     std::string get(size_t row, size_t col) const;
 
+    /**
+     * @brief 특정 셀의 값을 복사 없이 가져옵니다
+     * @param row 행 인덱스 (0부터 시작)
+     * @param col 열 인덱스 (0부터 시작)
+     * @return 셀 내용을 가리키는 뷰
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     *
+     * @warning 반환된 뷰는 다음 parse()/materialize() 호출 또는 파서 소멸 시 무효화됩니다.
+     *          Lazy 모드에서 따옴표로 감싼 셀의 뷰는 그 행이 캐시에서 밀려나면(다른 행을
+     *          lazy_cache_rows개 읽으면) 무효화되므로 오래 쓸 값은 get()으로 복사하세요.
+     */
+    std::string_view getView(size_t row, size_t col) const;
+
     /**
      * @brief 헤더 이름으로 열 인덱스를 찾습니다
      * @param header_name 찾을 헤더 이름
@@ -51,6 +353,132 @@ public:
      */
     size_t findColumn(const std::string& header_name) const;
 
+    /**
+     * @brief 헤더 이름으로 열 전체를 가져옵니다
+     * @param header_name 찾을 헤더 이름
+     * @return 연속 버퍼와 오프셋 배열로 된 열
+     * @throws std::runtime_error 헤더를 찾지 못했을 때
+     *
+     * @warning 반환된 열은 다음 parse()/materialize() 호출 또는 파서 소멸 시 무효화됩니다
+     */
+    const CSVTable::Column& column(const std::string& header_name) const;
+
+    /**
+     * @brief 열을 숫자 타입으로 변환합니다
+     * @param header_name 변환할 열의 헤더 이름
+     * @param type 변환할 타입
+     * @return 모든 값이 변환되면 true (실패하면 열은 그대로)
+     * @throws std::runtime_error 헤더를 찾지 못했을 때
+     */
+    bool convertColumn(const std::string& header_name, ColumnType type);
+
+    /**
+     * @brief Int64 열의 값을 가져옵니다
+     * @param row 행 인덱스
+     * @param col 열 인덱스
+     * @return 정수 값
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     * @throws std::runtime_error 열이 Int64가 아닐 때
+     */
+    int64_t getInt(size_t row, size_t col) const;
+
+    /**
+     * @brief 숫자 열의 값을 실수로 가져옵니다
+     * @param row 행 인덱스
+     * @param col 열 인덱스
+     * @return 실수 값
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     * @throws std::runtime_error 열이 숫자 타입이 아닐 때
+     */
+    double getDouble(size_t row, size_t col) const;
+
+    /**
+     * @brief 헤더 이름으로 숫자 열의 값 배열을 가져옵니다
+     * @tparam T int64_t 또는 double
+     * @param header_name 찾을 헤더 이름
+     * @return 값 배열
+     * @throws std::runtime_error 헤더가 없거나 열 타입이 T와 다를 때
+     */
+    template <typename T>
+    const ColumnBuffer<T>& column(const std::string& header_name) const {
+        return loaded().column<T>(header_name);
+    }
+
+    /**
+     * @brief 숫자 열을 집계합니다 (CSVTable::aggregate() 참고)
+     * @param header_name 집계할 열 이름
+     * @param ops 구할 집계 함수들
+     * @return ops와 같은 순서의 결과
+     * @throws std::runtime_error 헤더가 없거나 열이 숫자 타입이 아닐 때
+     */
+    std::vector<double> aggregate(const std::string& header_name, const std::vector<AggregateOp>& ops) const;
+
+    /**
+     * @brief 키 열로 묶어 집계한 새 테이블을 만듭니다 (CSVTable::groupBy() 참고)
+     * @param keys 묶을 키 열 이름들
+     * @param aggregates 그룹마다 구할 집계들
+     * @param threads 집계 스레드 수 (0이면 CPU 코어 수)
+     * @return 키 열들 + 집계 열들로 된 테이블
+     * @throws std::runtime_error 열이 없거나 집계 대상 열이 숫자 타입이 아닐 때
+     *
+     * @example
+     * CSVTable by_city = parser.groupBy({"city"}, {{"score", AggregateOp::Mean}}, 0);
+     */
+    CSVTable groupBy(const std::vector<std::string>& keys, const std::vector<GroupAggregate>& aggregates,
+                     size_t threads = 1) const;
+
+    /**
+     * @brief 다른 파서의 테이블과 키 열로 해시 조인한 새 테이블을 만듭니다 (CSVTable::join() 참고)
+     * @param right 오른쪽 파서
+     * @param left_key 이 파서의 키 열 이름
+     * @param right_key 오른쪽 파서의 키 열 이름
+     * @param options 조인 종류, 결과 열, 스레드 수
+     * @return 왼쪽 열들 + 오른쪽 열들로 된 테이블 (결과 열의 셀만 복사하므로 두 파서와 독립)
+     * @throws std::runtime_error 열이 없을 때
+     *
+     * @example
+     * JoinOptions options;
+     * options.type = JoinType::Left;
+     * options.threads = 0;
+     * CSVTable joined = people.join(scores, "name", "name", options);
+     */
+    CSVTable join(const CSVParser& right, const std::string& left_key, const std::string& right_key,
+                  const JoinOptions& options = JoinOptions()) const;
+
+    /**
+     * @brief 한 열 기준으로 행을 정렬합니다 (CSVTable::sortBy() 참고)
+     * @param header_name 정렬할 열 이름
+     * @param order 정렬 방향
+     * @param threads 문자열 병합 정렬 스레드 수 (0이면 CPU 코어 수)
+     * @throws std::runtime_error 헤더가 없을 때
+     *
+     * @example
+     * parser.sortBy("score", SortOrder::Descending);
+     */
+    void sortBy(const std::string& header_name, SortOrder order = SortOrder::Ascending, size_t threads = 1);
+
+    /**
+     * @brief 여러 열 기준으로 행을 정렬합니다 (앞의 키가 우선, 안정 정렬)
+     * @param keys 정렬 키들
+     * @param threads 문자열 병합 정렬 스레드 수 (0이면 CPU 코어 수)
+     * @throws std::runtime_error 헤더가 없을 때
+     *
+     * @example
+     * parser.sortBy({{"city"}, {"score", SortOrder::Descending}});
+     */
+    void sortBy(const std::vector<SortKey>& keys, size_t threads = 1);
+
+    /**
+     * @brief 모든 조건을 만족하는 행을 찾습니다 (CSVTable::select() 참고)
+     * @param predicates 행 조건들
+     * @return 조건을 만족하는 행 인덱스 (오름차순)
+     * @throws std::runtime_error 조건의 열이 없을 때
+     *
+     * @example
+     * auto seoul = parser.select({CSVPredicate("city", CompareOp::Equal, "Seoul")});
+     */
+    std::vector<uint32_t> select(const std::vector<CSVPredicate>& predicates) const;
+
     /**
      * @brief 특정 행의 모든 값을 가져옵니다
      * @param row 행 인덱스
@@ -59,6 +487,44 @@ public:
      */
     std::vector<std::string> getRow(size_t row) const;
 
+    /**
+     * @brief 특정 행의 모든 값을 복사 없이 가져옵니다
+     * @param row 행 인덱스
+     * @return 셀 뷰 벡터
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     *
+     * @warning 반환된 뷰는 다음 parse()/materialize() 호출 또는 파서 소멸 시 무효화됩니다
+     *          (Lazy 모드의 따옴표 셀은 getView()와 같이 캐시에서 밀려날 때까지)
+     */
+    std::vector<std::string_view> getRowView(size_t row) const;
+
+    /**
+     * @brief Mapped 모드로 파싱된 데이터인지 확인합니다
+     * @return 셀이 매핑된 파일을 가리키고 있으면 true
+     */
+    bool isMapped() const;
+
+    /**
+     * @brief Lazy 모드로 파싱했는지 확인합니다
+     * @return 행을 필요할 때 토큰화하는 중이면 true (materialize() 후에는 false)
+     */
+    bool isLazy() const;
+
+    /**
+     * @brief Lazy 모드에서 사이드카 색인을 읽어 열었는지 확인합니다
+     * @return buildIndex()로 만든 색인을 쓰고 있으면 true (스캔했거나 Lazy가 아니면 false)
+     */
+    bool usesRowIndex() const;
+
+    /**
+     * @brief Mapped 모드의 셀을 한 번만 복사하여 소유 데이터로 전환합니다
+     *
+     * 호출 후에는 매핑을 해제하므로 원본 파일이 바뀌어도 안전합니다.
+     * 이미 Copy 모드라면 아무 일도 하지 않습니다.
+     * Lazy 모드에서는 색인한 파일 전체를 파싱해 테이블을 만듭니다 (parse() 옵션의 타입 추론 등도 적용).
+     */
+    void materialize();
+
     /**
      * @brief CSV 데이터를 콘솔에 출력합니다
      *
@@ -69,9 +535,37 @@ public:
     /**
      * @brief CSV 데이터를 파일로 저장합니다
      * @param filename 저장할 파일 경로
-     * @throws std::runtime_error 파일을 열 수 없을 때
+     * @param options 쓰기 옵션 (스레드 수, 버퍼 크기)
+     * @throws std::runtime_error 파일을 열 수 없거나 쓰기에 실패했을 때
+     *
+     * @note CSVWriter로 버퍼에 모아 쓰며, 구분자나 따옴표가 든 셀은 따옴표로 감쌉니다
+     * @note 숫자로 변환된 열은 std::to_chars로 값을 포맷합니다 (예: 88.0 → 88)
      */
-    void write(const std::string& filename) const;
+    void write(const std::string& filename, const WriteOptions& options = WriteOptions()) const;
+
+    /**
+     * @brief 테이블을 바이너리 스냅샷으로 저장합니다
+     * @param filename 저장할 파일 경로
+     * @throws std::runtime_error 파일을 쓸 수 없을 때
+     *
+     * @note 숫자로 변환된 열은 값 배열도 함께 저장하므로 다시 불러올 때 변환하지 않습니다
+     * @note 형식은 mylib/csv_snapshot.h 참고 (C csv_load_binary()로도 읽을 수 있음)
+     */
+    void saveSnapshot(const std::string& filename) const;
+
+    /**
+     * @brief 바이너리 스냅샷을 메모리 매핑으로 불러옵니다
+     * @param filename 스냅샷 파일 경로
+     * @param verify_checksum true이면 본문 체크섬까지 검사 (파일 전체를 읽음)
+     * @throws std::runtime_error 파일을 열 수 없거나 형식이 맞지 않거나 손상되었을 때
+     *
+     * @note 셀과 숫자 값은 복사하지 않고 매핑을 가리키므로 isMapped()가 true가 되며,
+     *       불러오는 시간은 행 수가 아니라 열 수에 비례합니다
+     * @note 셀 위치는 읽을 때마다 열의 힙 범위 안인지 검사하므로, 손상된 파일이어도 get() 등은
+     *       범위 밖을 읽지 않고 std::runtime_error를 던집니다.
+     *       verify_checksum 없이는 셀 내용이나 숫자 값이 바뀐 것은 알아채지 못합니다
+     */
+    void loadSnapshot(const std::string& filename, bool verify_checksum = false);
 
     /**
      * @brief CSV 데이터의 행 개수를 반환합니다
@@ -90,6 +584,13 @@ public:
      * @return 헤더 벡터
      */
     const std::vector<std::string>& headers() const;
+
+    /**
+     * @brief 파싱된 테이블을 반환합니다
+     * @return 열 우선 테이블
+     * @throws std::logic_error Lazy 모드일 때 (열 단위 기능도 모두 같음, 먼저 materialize())
+     */
+    const CSVTable& table() const;
 };
 
 } // namespace mylib
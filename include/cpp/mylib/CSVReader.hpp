@@ -0,0 +1,146 @@
+#ifndef CSV_READER_HPP
+#define CSV_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct CSVStream;
+
+namespace mylib {
+
+/**
+ * @brief 읽기 통계 (C CSVReadAheadStats와 같은 값)
+ *
+ * 생산자 대기가 길면 파싱이, 소비자 대기가 길면 I/O가 병목입니다.
+ */
+struct IOStats {
+    uint64_t bytes_read = 0;          /**< 파일에서 읽은 바이트 수 */
+    uint64_t blocks_read = 0;         /**< 채운 블록 수 */
+    uint64_t producer_stall_ns = 0;   /**< 읽기 스레드가 빈 블록을 기다린 시간 */
+    uint64_t consumer_stall_ns = 0;   /**< 파서가 채워진 블록을 기다린 시간 */
+    bool threaded = false;            /**< 미리 읽기 스레드를 썼는지 */
+};
+
+/**
+ * @brief 스트리밍 CSV 리더 클래스
+ *
+ * 파일을 블록 단위로 읽으며 한 번에 한 행씩 제공합니다.
+ * 행 버퍼를 재사용하므로 메모리 사용량은 가장 긴 행의 길이에 비례합니다.
+ * 블록은 별도 스레드가 미리 읽어 두므로 읽기와 토큰화가 겹칩니다.
+ * RAII 패턴으로 소멸 시 파일을 자동으로 닫습니다.
+ *
+ * @example
+ * CSVReader reader("data.csv");
+ * for (const auto& row : reader) {
+ *     // row[i]는 std::string_view, 다음 행으로 넘어가면 무효화됨
+ * }
+ */
+class CSVReader {
+private:
+    CSVStream* stream_;
+    std::vector<std::string> headers_;
+    std::vector<size_t> columns_;   // 프로젝션: 원본 열 인덱스 (비어 있으면 전체)
+    std::vector<size_t> repeats_;   // 프로젝션 위치별로 같은 원본 열을 앞서 고른 위치 (없으면 자기 자신)
+    std::vector<std::string_view> row_;
+
+    void close();
+
+public:
+    /**
+     * @brief 입력 반복자 (한 번만 순회 가능)
+     */
+    class Iterator {
+    private:
+        CSVReader* reader_;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::vector<std::string_view>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        explicit Iterator(CSVReader* reader = nullptr) : reader_(reader) {}
+
+        reference operator*() const { return reader_->row(); }
+        pointer operator->() const { return &reader_->row(); }
+
+        Iterator& operator++() {
+            if (!reader_->next()) {
+                reader_ = nullptr;
+            }
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const { return reader_ == other.reader_; }
+        bool operator!=(const Iterator& other) const { return reader_ != other.reader_; }
+    };
+
+    /**
+     * @brief CSV 파일을 열고 헤더를 읽습니다
+     * @param filename 읽을 CSV 파일 경로
+     * @param columns 읽을 열 이름 (비어 있으면 전체, 지정하면 이 순서로 제공)
+     * @throws std::runtime_error 파일을 열 수 없거나 열 이름을 찾지 못했을 때
+     *
+     * @note 프로젝션에서 빠진 필드는 구분자 위치만 찾고 복원하지 않습니다
+     */
+    explicit CSVReader(const std::string& filename, const std::vector<std::string>& columns = {});
+
+    /**
+     * @brief 소멸자 - 자동으로 파일 닫기
+     */
+    ~CSVReader();
+
+    // 복사 금지, 이동 허용
+    CSVReader(const CSVReader&) = delete;
+    CSVReader& operator=(const CSVReader&) = delete;
+    CSVReader(CSVReader&& other) noexcept;
+    CSVReader& operator=(CSVReader&& other) noexcept;
+
+    /**
+     * @brief 헤더 목록을 반환합니다
+     * @return 헤더 벡터 (프로젝션을 지정했으면 선택한 열만)
+     */
+    const std::vector<std::string>& headers() const;
+
+    /**
+     * @brief 다음 행으로 이동합니다
+     * @return 행을 읽었으면 true, 파일 끝이면 false
+     * @throws std::runtime_error 읽기 실패 시
+     */
+    bool next();
+
+    /**
+     * @brief 현재 행을 반환합니다
+     * @return 셀 뷰 벡터 (다음 next() 호출 전까지 유효)
+     *
+     * @note 프로젝션을 지정했으면 항상 headers()와 같은 개수이며, 없는 필드는 빈 뷰입니다
+     */
+    const std::vector<std::string_view>& row() const;
+
+    /**
+     * @brief 지금까지의 읽기 통계를 반환합니다
+     * @return 읽은 바이트 수와 양쪽 대기 시간
+     */
+    IOStats ioStats() const;
+
+    /**
+     * @brief 첫 행을 읽고 반복자를 반환합니다
+     * @return 시작 반복자 (행이 없으면 end()와 같음)
+     */
+    Iterator begin();
+
+    /**
+     * @brief 끝 반복자를 반환합니다
+     * @return 끝 반복자
+     */
+    Iterator end();
+};
+
+} // namespace mylib
+
+#endif // CSV_READER_HPP
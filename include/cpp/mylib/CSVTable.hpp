@@ -0,0 +1,645 @@
+#ifndef CSV_TABLE_HPP
+#define CSV_TABLE_HPP
+
+#include "cpp/mylib/CSVFilter.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mylib {
+
+/**
+ * @brief 열의 값 타입
+ */
+enum class ColumnType {
+    String,  /**< 문자열 (기본값) */
+    Int64,   /**< 64비트 정수 */
+    Double   /**< 배정밀도 실수 */
+};
+
+/**
+ * @brief 집계 함수
+ */
+enum class AggregateOp {
+    Sum,    /**< 합계 */
+    Min,    /**< 최솟값 */
+    Max,    /**< 최댓값 */
+    Mean,   /**< 평균 */
+    Count   /**< 값 개수 */
+};
+
+/**
+ * @brief 정렬 방향
+ */
+enum class SortOrder {
+    Ascending,   /**< 오름차순 */
+    Descending   /**< 내림차순 */
+};
+
+/**
+ * @brief 정렬 키 (열 + 방향)
+ */
+struct SortKey {
+    std::string column;                      /**< 정렬할 열 이름 */
+    SortOrder order = SortOrder::Ascending;  /**< 정렬 방향 */
+};
+
+/**
+ * @brief GROUP BY에서 구할 집계 (열 + 함수)
+ */
+struct GroupAggregate {
+    std::string column;   /**< 집계할 열 이름 (Count는 아무 열이나 가능) */
+    AggregateOp op;       /**< 집계 함수 */
+};
+
+/**
+ * @brief 조인 종류
+ */
+enum class JoinType {
+    Inner,   /**< 키가 맞는 행 쌍만 */
+    Left     /**< 왼쪽 행은 모두 (맞는 오른쪽 행이 없으면 오른쪽 열은 빈 셀) */
+};
+
+/**
+ * @brief join() 옵션
+ */
+struct JoinOptions {
+    JoinType type = JoinType::Inner;         /**< 조인 종류 */
+    std::vector<std::string> left_columns;   /**< 결과에 넣을 왼쪽 열 (비어 있으면 전체) */
+    std::vector<std::string> right_columns;  /**< 결과에 넣을 오른쪽 열 (비어 있으면 키를 뺀 전체) */
+    std::string right_suffix = "_right";     /**< 왼쪽 열과 이름이 겹치는 오른쪽 열에 붙일 접미사 */
+    size_t threads = 1;                      /**< 탐사/복사 스레드 수 (0이면 CPU 코어 수) */
+};
+
+/**
+ * @brief 소유하거나 빌려 쓰는 연속 배열
+ *
+ * 평소에는 std::vector로 값을 소유하고, borrow()하면 외부 메모리(예: 매핑된 스냅샷)를
+ * 복사 없이 가리킵니다. 빌린 배열을 수정하려 하면 그때 한 번 복사합니다.
+ *
+ * @tparam T 원소 타입
+ */
+template <typename T>
+class ColumnBuffer {
+private:
+    std::vector<T> owned_;
+    const T* borrowed_ = nullptr;
+    size_t borrowed_size_ = 0;
+
+public:
+    /**
+     * @brief 외부 배열을 빌립니다 (기존 값은 버림)
+     * @param data 배열 시작 (버퍼보다 오래 살아야 함)
+     * @param size 원소 개수
+     */
+    void borrow(const T* data, size_t size) {
+        owned_.clear();
+        owned_.shrink_to_fit();
+        borrowed_ = data;
+        borrowed_size_ = size;
+    }
+
+    /**
+     * @brief 수정 가능한 소유 벡터를 반환합니다 (빌린 상태면 먼저 복사)
+     * @return 소유 벡터
+     */
+    std::vector<T>& owned() {
+        if (borrowed_ != nullptr) {
+            owned_.assign(borrowed_, borrowed_ + borrowed_size_);
+            borrowed_ = nullptr;
+            borrowed_size_ = 0;
+        }
+        return owned_;
+    }
+
+    bool isBorrowed() const { return borrowed_ != nullptr; }
+    const T* data() const { return borrowed_ != nullptr ? borrowed_ : owned_.data(); }
+    size_t size() const { return borrowed_ != nullptr ? borrowed_size_ : owned_.size(); }
+    bool empty() const { return size() == 0; }
+    const T& operator[](size_t index) const { return data()[index]; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + size(); }
+};
+
+/**
+ * @brief 열 우선(columnar) CSV 테이블 클래스
+ *
+ * 셀을 행마다 따로 할당하지 않고 열마다 하나의 연속 바이트 버퍼와
+ * 오프셋/길이 배열로 보관합니다. 한 열만 훑는 집계는 다른 열을 건드리지 않고
+ * 연속 메모리를 순서대로 읽습니다.
+ *
+ * 열은 외부 버퍼(예: 메모리 매핑된 파일)를 빌려 쓸 수도 있습니다.
+ * 이 경우 오프셋은 빌린 버퍼의 시작 기준이며, 버퍼는 테이블보다 오래 살아야 합니다.
+ *
+ * 서로 다른 값이 적은 문자열 열은 사전 인코딩할 수 있습니다. 서로 다른 값을 한 번씩만
+ * 저장하고 행마다 4바이트 코드만 두므로, 같은 값이 반복되는 열의 메모리가 크게 줄고
+ * groupBy()/select()는 셀 대신 코드를 비교합니다.
+ *
+ * @note 헤더보다 짧은 행은 빈 셀로 채우고, 긴 행의 남는 셀은 버립니다
+ */
+class CSVTable {
+public:
+    // gather()에서 빈 셀을 뜻하는 행 번호
+    static constexpr uint32_t kMissingRow = 0xffffffffu;
+
+    /**
+     * @brief 테이블의 한 열
+     *
+     * 문자열 값은 항상 유지되며, 숫자 타입으로 변환하면 타입별 배열이 추가됩니다.
+     * 사전 인코딩된 열은 offsets()/lengths()가 사전 항목을 가리키고, 행은 codes()로 항목을 고릅니다.
+     */
+    class Column {
+    private:
+        const char* borrowed_;             // 빌린 외부 버퍼 (nullptr이면 heap_ 사용)
+        std::vector<char> heap_;           // 소유한 셀 바이트 (행 순서로 연속 저장)
+        ColumnBuffer<uint64_t> offsets_;   // 셀 시작 오프셋
+        ColumnBuffer<uint32_t> lengths_;   // 셀 길이
+        ColumnBuffer<uint32_t> codes_;     // 사전 열: 행별 사전 항목 번호
+        bool dictionary_;                  // true면 offsets_/lengths_는 사전 항목 (행이 아님)
+        ColumnType type_;
+        ColumnBuffer<int64_t> ints_;
+        ColumnBuffer<double> doubles_;
+        uint64_t heap_limit_;              // 빌린 힙의 바이트 수 (검사하지 않는 열은 최댓값)
+
+        // 빌린 배열은 불러올 때 행마다 검사하지 않으므로 셀을 읽을 때 힙 범위를 확인
+        std::string_view entry(size_t index) const {
+            const uint64_t offset = offsets_[index];
+            const uint32_t length = lengths_[index];
+            if (length > heap_limit_ || offset > heap_limit_ - length) {
+                corruptCell();
+            }
+            return std::string_view(data() + offset, length);
+        }
+
+        [[noreturn]] static void corruptCell();
+
+        void appendDictionary(const Column& other);
+
+    public:
+        /**
+         * @brief 열을 생성합니다
+         * @param borrowed 셀이 가리킬 외부 버퍼 시작 (nullptr이면 셀을 복사하여 소유)
+         */
+        explicit Column(const char* borrowed = nullptr);
+
+        /**
+         * @brief 셀을 하나 추가합니다
+         * @param value 셀 값 (빌린 열이면 빌린 버퍼 안을 가리켜야 함)
+         * @throws std::length_error 셀이 4 GiB 이상일 때
+         */
+        void append(std::string_view value);
+
+        /**
+         * @brief 정수 셀을 추가합니다 (std::to_chars로 포맷한 텍스트도 함께 저장)
+         * @param value 값
+         *
+         * @note 빈 열이나 Int64 열이면 Int64로 유지되고, 다른 타입이면 String으로 바뀝니다
+         */
+        void appendInt(int64_t value);
+
+        /**
+         * @brief 실수 셀을 추가합니다 (std::to_chars로 포맷한 텍스트도 함께 저장)
+         * @param value 값
+         *
+         * @note 빈 열이나 Double 열이면 Double로 유지되고, 다른 타입이면 String으로 바뀝니다
+         */
+        void appendDouble(double value);
+
+        /**
+         * @brief 외부 메모리의 배열을 복사 없이 빌려 열 내용을 바꿉니다
+         * @param heap 셀 바이트 시작 (오프셋의 기준)
+         * @param offsets 셀 시작 오프셋 배열 (rows개)
+         * @param lengths 셀 길이 배열 (rows개)
+         * @param rows 행 개수
+         * @param type 값 타입
+         * @param values 타입 배열 (Int64면 int64_t[rows], Double이면 double[rows], String이면 무시)
+         * @param heap_size 셀 바이트 수 (셀을 읽을 때 [heap, heap + heap_size) 안인지 검사)
+         *
+         * @note 모든 배열은 열보다 오래 살아야 합니다 (예: 매핑된 스냅샷)
+         * @note 오프셋/길이는 빌릴 때 훑지 않으므로 범위를 벗어난 셀은 읽을 때
+         *       std::runtime_error를 던집니다 (offsets()/lengths()/data()로 직접 읽으면 검사 없음)
+         */
+        void borrowArrays(const char* heap, const uint64_t* offsets, const uint32_t* lengths,
+                          size_t rows, ColumnType type, const void* values, uint64_t heap_size);
+
+        /**
+         * @brief 다른 열의 셀을 뒤에 이어 붙입니다
+         * @param other 같은 버퍼를 빌렸거나 둘 다 소유한 열
+         */
+        void appendColumn(Column&& other);
+
+        /**
+         * @brief 빌린 셀과 배열을 자체 버퍼로 복사하여 소유 열로 전환합니다
+         */
+        void materialize();
+
+        /**
+         * @brief 행 순서를 바꿉니다 (새 행 i = 기존 행 order[i])
+         * @param order 순열 (size()개)
+         *
+         * @note 오프셋/길이/타입 배열만 옮기고 셀 바이트는 그대로 둡니다 (빌린 버퍼도 유지).
+         *       사전 열은 코드 배열만 옮깁니다.
+         */
+        void permute(const std::vector<uint32_t>& order);
+
+        /**
+         * @brief 고른 행들로 새 소유 열을 만듭니다 (새 행 i = 기존 행 rows[i])
+         * @param rows 기존 행 인덱스 (kMissingRow이면 빈 셀, 같은 행이 여러 번 나와도 됨)
+         * @return 새 열 (빌린 버퍼를 가리키지 않음)
+         *
+         * @note 고른 셀의 바이트만 복사합니다. 사전 열은 사전을 복사하고 코드만 고릅니다.
+         * @note 숫자 열은 빈 셀이 없으면 타입 배열도 고르고, 빈 셀이 있으면 String 열이 됩니다
+         */
+        Column gather(const std::vector<uint32_t>& rows) const;
+
+        /**
+         * @brief 서로 다른 값이 적으면 사전 인코딩합니다
+         * @param max_distinct 허용할 서로 다른 값의 최대 개수
+         * @return 인코딩했거나 이미 사전 열이면 true, 문자열 열이 아니거나 값이 더 많으면 false (열은 그대로)
+         *
+         * @note 인코딩하면 사전 항목을 자체 버퍼로 복사하므로 빌린 버퍼를 더 이상 가리키지 않습니다
+         * @note 항목 번호는 값이 처음 나온 순서입니다
+         */
+        bool encodeDictionary(size_t max_distinct);
+
+        /**
+         * @brief 사전 열을 행마다 셀을 저장하는 보통 열로 되돌립니다 (사전 열이 아니면 아무것도 안 함)
+         *
+         * @note append()나 사전 열이 아닌 열과의 appendColumn()은 먼저 이 함수를 부릅니다
+         */
+        void decodeDictionary();
+
+        /**
+         * @brief 사전 인코딩된 열인지 확인합니다
+         * @return 사전 열이면 true
+         */
+        bool isDictionary() const { return dictionary_; }
+
+        /**
+         * @brief 행별 사전 항목 번호를 반환합니다
+         * @return 코드 배열 (사전 열이 아니면 비어 있음)
+         */
+        const ColumnBuffer<uint32_t>& codes() const { return codes_; }
+
+        /**
+         * @brief 사전 항목 개수를 반환합니다
+         * @return 서로 다른 값의 개수 (사전 열이 아니면 0)
+         */
+        size_t dictionarySize() const { return dictionary_ ? offsets_.size() : 0; }
+
+        /**
+         * @brief 사전 항목의 값을 반환합니다 (범위 검사 없음)
+         * @param code 항목 번호 (dictionarySize() 미만)
+         * @return 값을 가리키는 뷰
+         */
+        std::string_view dictionaryValue(uint32_t code) const { return entry(code); }
+
+        /**
+         * @brief 모든 값을 지정한 타입으로 변환합니다
+         * @param type 변환할 타입
+         * @return 모든 값이 변환되면 true, 하나라도 실패하면 false (열은 그대로)
+         */
+        bool convert(ColumnType type);
+
+        /**
+         * @brief 앞부분 표본으로 타입을 추론하고 전체 열을 변환합니다
+         * @param sample_rows 표본 행 수 (0이면 전체)
+         * @return 최종 타입 (표본 밖의 값이 변환되지 않으면 더 넓은 타입으로 물러남)
+         *
+         * @note 표본이 모두 정수이면 Int64, 모두 숫자이면 Double, 아니면 String입니다.
+         *       빈 셀은 숫자가 아니므로 String으로 분류됩니다.
+         */
+        ColumnType infer(size_t sample_rows);
+
+        /**
+         * @brief 셀 값을 반환합니다 (행 범위 검사 없음)
+         * @param row 행 인덱스
+         * @return 셀 내용을 가리키는 뷰
+         * @throws std::runtime_error 빌린 셀이 힙 밖을 가리킬 때 (손상된 스냅샷)
+         */
+        std::string_view operator[](size_t row) const {
+            return entry(dictionary_ ? codes_[row] : row);
+        }
+
+        /**
+         * @brief 셀 값을 반환합니다
+         * @param row 행 인덱스
+         * @return 셀 내용을 가리키는 뷰
+         * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+         */
+        std::string_view at(size_t row) const;
+
+        /**
+         * @brief 셀 개수를 반환합니다
+         * @return 행 개수
+         */
+        size_t size() const { return dictionary_ ? codes_.size() : offsets_.size(); }
+
+        /**
+         * @brief 셀 바이트 버퍼의 시작을 반환합니다
+         * @return 오프셋의 기준 포인터
+         */
+        const char* data() const { return borrowed_ != nullptr ? borrowed_ : heap_.data(); }
+
+        /**
+         * @brief 셀 시작 오프셋 배열을 반환합니다
+         * @return data() 기준 오프셋 (사전 열이면 사전 항목별)
+         */
+        const ColumnBuffer<uint64_t>& offsets() const { return offsets_; }
+
+        /**
+         * @brief 셀 길이 배열을 반환합니다
+         * @return 바이트 단위 길이 (사전 열이면 사전 항목별)
+         */
+        const ColumnBuffer<uint32_t>& lengths() const { return lengths_; }
+
+        /**
+         * @brief 외부 버퍼를 빌려 쓰는 열인지 확인합니다
+         * @return 빌린 열이면 true
+         */
+        bool isBorrowed() const {
+            return borrowed_ != nullptr || offsets_.isBorrowed() || lengths_.isBorrowed() || codes_.isBorrowed();
+        }
+
+        /**
+         * @brief 열의 값 타입을 반환합니다
+         * @return 변환하지 않았으면 ColumnType::String
+         */
+        ColumnType type() const { return type_; }
+
+        /**
+         * @brief Int64 열의 값 배열을 반환합니다
+         * @return 정수 배열 (다른 타입이면 비어 있음)
+         */
+        const ColumnBuffer<int64_t>& ints() const { return ints_; }
+
+        /**
+         * @brief Double 열의 값 배열을 반환합니다
+         * @return 실수 배열 (다른 타입이면 비어 있음)
+         */
+        const ColumnBuffer<double>& doubles() const { return doubles_; }
+    };
+
+private:
+    std::vector<std::string> headers_;
+    std::vector<Column> columns_;
+
+public:
+    /**
+     * @brief 빈 테이블을 생성합니다
+     */
+    CSVTable() = default;
+
+    /**
+     * @brief 헤더로 열을 만듭니다
+     * @param headers 열 이름
+     * @param borrowed 셀이 가리킬 외부 버퍼 시작 (nullptr이면 셀을 복사)
+     */
+    explicit CSVTable(std::vector<std::string> headers, const char* borrowed = nullptr);
+
+    /**
+     * @brief 헤더와 이미 만든 열로 테이블을 구성합니다
+     * @param headers 열 이름
+     * @param columns 열 (headers와 개수가 같고 행 수가 모두 같아야 함)
+     * @throws std::invalid_argument 개수나 행 수가 맞지 않을 때
+     */
+    CSVTable(std::vector<std::string> headers, std::vector<Column> columns);
+
+    /**
+     * @brief 행을 추가합니다 (헤더 개수에 맞춰 채우거나 자름)
+     * @param row 셀 값
+     */
+    void appendRow(const std::vector<std::string_view>& row);
+
+    /**
+     * @brief 다른 테이블의 행을 뒤에 이어 붙입니다
+     * @param other 열 개수가 같은 테이블
+     * @throws std::invalid_argument 열 개수가 다를 때
+     */
+    void appendTable(CSVTable&& other);
+
+    /**
+     * @brief 빌린 열을 모두 소유 열로 전환합니다
+     */
+    void materialize();
+
+    /**
+     * @brief 열을 지정한 타입으로 변환합니다
+     * @param col 열 인덱스
+     * @param type 변환할 타입
+     * @return 모든 값이 변환되면 true
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     */
+    bool convertColumn(size_t col, ColumnType type);
+
+    /**
+     * @brief 모든 열의 타입을 추론하여 변환합니다
+     * @param sample_rows 열마다 살펴볼 표본 행 수 (0이면 전체)
+     */
+    void inferTypes(size_t sample_rows);
+
+    /**
+     * @brief 서로 다른 값이 적은 문자열 열을 모두 사전 인코딩합니다
+     * @param max_distinct 열마다 허용할 서로 다른 값의 최대 개수
+     * @return 사전 열이 된 열 개수 (이미 사전 열이던 것 포함)
+     */
+    size_t encodeDictionaries(size_t max_distinct);
+
+    /**
+     * @brief 모든 조건을 만족하는 행을 찾습니다
+     * @param predicates 행 조건들 (비어 있으면 모든 행)
+     * @return 조건을 만족하는 행 인덱스 (오름차순)
+     * @throws std::runtime_error 조건의 열이 없을 때
+     * @throws std::length_error 행이 2^32개 이상일 때
+     *
+     * @note 사전 열은 조건을 사전 항목마다 한 번만 평가하고 행은 코드로 고릅니다
+     *
+     * @example
+     * auto rows = table.select({CSVPredicate("city", CompareOp::Equal, "Seoul")});
+     */
+    std::vector<uint32_t> select(const std::vector<CSVPredicate>& predicates) const;
+
+    /**
+     * @brief Int64 열의 값을 반환합니다
+     * @param row 행 인덱스
+     * @param col 열 인덱스
+     * @return 정수 값
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     * @throws std::runtime_error 열이 Int64가 아닐 때
+     */
+    int64_t getInt(size_t row, size_t col) const;
+
+    /**
+     * @brief 숫자 열의 값을 실수로 반환합니다
+     * @param row 행 인덱스
+     * @param col 열 인덱스
+     * @return 실수 값 (Int64 열은 double로 변환)
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     * @throws std::runtime_error 열이 숫자 타입이 아닐 때
+     */
+    double getDouble(size_t row, size_t col) const;
+
+    /**
+     * @brief 헤더 이름으로 타입 배열을 가져옵니다
+     * @tparam T int64_t (Int64 열) 또는 double (Double 열)
+     * @param header_name 찾을 헤더 이름
+     * @return 값 배열
+     * @throws std::runtime_error 헤더가 없거나 열 타입이 T와 다를 때
+     *
+     * @example
+     * const auto& scores = table.column<double>("score");
+     */
+    template <typename T>
+    const ColumnBuffer<T>& column(const std::string& header_name) const;
+
+    /**
+     * @brief 숫자 열을 집계합니다
+     * @param header_name 집계할 열 이름
+     * @param ops 구할 집계 함수들
+     * @return ops와 같은 순서의 결과 (행이 없으면 Min/Max/Mean은 NaN)
+     * @throws std::runtime_error 헤더가 없거나 열이 숫자 타입이 아닐 때
+     *
+     * @note 요청한 함수 개수와 관계없이 값 배열을 SIMD로 한 번만 훑습니다 (mylib/reduce.h)
+     * @note Int64 열의 Sum/Min/Max는 정수 그대로 계산한 뒤 double로 돌려줍니다
+     *
+     * @example
+     * auto stats = table.aggregate("score", {AggregateOp::Sum, AggregateOp::Mean});
+     */
+    std::vector<double> aggregate(const std::string& header_name, const std::vector<AggregateOp>& ops) const;
+
+    /**
+     * @brief 키 열 값이 같은 행끼리 묶어 집계한 새 테이블을 만듭니다
+     * @param keys 묶을 키 열 이름들 (하나 이상)
+     * @param aggregates 그룹마다 구할 집계들
+     * @param threads 집계 스레드 수 (0이면 CPU 코어 수)
+     * @return 키 열들 + 집계 열들 ("mean(score)" 형식의 이름)로 된 테이블, 그룹은 처음 나온 순서
+     * @throws std::invalid_argument 키가 비어 있을 때
+     * @throws std::runtime_error 열이 없거나 Sum/Min/Max/Mean 대상 열이 숫자 타입이 아닐 때
+     *
+     * @note 행마다 키 해시를 미리 구한 뒤 스레드별 오픈 어드레싱 해시 테이블에 부분 집계하고 합칩니다
+     * @note 사전 열 키는 셀 대신 코드로 해시하고 비교하며, 키가 사전 열 하나뿐이면
+     *       해시 테이블 없이 코드를 그룹 번호로 바로 씁니다
+     * @note Count와 Int64 열의 Sum/Min/Max는 Int64 열, 나머지는 Double 열이 됩니다
+     *
+     * @example
+     * CSVTable by_city = table.groupBy({"city"}, {{"score", AggregateOp::Mean}});
+     */
+    CSVTable groupBy(const std::vector<std::string>& keys, const std::vector<GroupAggregate>& aggregates,
+                     size_t threads = 1) const;
+
+    /**
+     * @brief 키 열 값이 같은 행끼리 이어 붙인 새 테이블을 만듭니다 (해시 조인)
+     * @param right 오른쪽 테이블
+     * @param left_key 이 테이블(왼쪽)의 키 열 이름
+     * @param right_key 오른쪽 테이블의 키 열 이름
+     * @param options 조인 종류, 결과 열, 스레드 수
+     * @return 왼쪽 열들 + 오른쪽 열들로 된 테이블 (셀은 결과 열의 것만 복사)
+     * @throws std::runtime_error 열이 없을 때
+     * @throws std::length_error 입력이나 결과 행이 2^32개 이상일 때
+     *
+     * @note 행이 적은 쪽의 키로 체인 해시 테이블을 만들고 큰 쪽을 구간으로 나누어 병렬로 탐사합니다.
+     *       메모리는 작은 쪽 행 수 × 약 20바이트 + 결과 행 수 × 8바이트 + 결과 셀입니다.
+     * @note 키는 셀 텍스트로 비교합니다 (양쪽 모두 Int64 열이면 정수로 비교).
+     *       사전 열 키는 사전 항목마다 한 번만 해시합니다.
+     * @note 결과 행 순서는 탐사한 쪽(큰 쪽, 같으면 왼쪽)의 행 순서이고, 한 행에 맞는 행이 여럿이면
+     *       그 행들의 순서를 따릅니다. 왼쪽을 해시했을 때 Left 조인의 짝 없는 왼쪽 행은 맨 뒤에 붙습니다.
+     *
+     * @example
+     * JoinOptions options;
+     * options.type = JoinType::Left;
+     * options.right_columns = {"city"};
+     * CSVTable joined = people.join(addresses, "name", "name", options);
+     */
+    CSVTable join(const CSVTable& right, const std::string& left_key, const std::string& right_key,
+                  const JoinOptions& options = JoinOptions()) const;
+
+    /**
+     * @brief 키 순서대로 정렬한 행 순열을 구합니다 (테이블은 그대로)
+     * @param keys 정렬 키들 (앞의 키가 우선, 같으면 다음 키로 비교)
+     * @param threads 문자열 병합 정렬 스레드 수 (0이면 CPU 코어 수)
+     * @return 정렬된 순서의 원래 행 인덱스
+     * @throws std::runtime_error 열이 없을 때
+     * @throws std::length_error 행이 2^32개 이상일 때
+     *
+     * @note 안정 정렬입니다 (모든 키가 같은 행은 원래 순서 유지)
+     * @note Int64/Double 열은 키를 뽑아 LSD 기수 정렬, 문자열 열은 바이트 순서로 병렬 병합 정렬합니다.
+     *       숫자로 변환하지 않은 열은 문자열로 비교합니다 ("10" < "9")
+     * @note NaN은 오름차순에서 맨 뒤에 놓입니다
+     * @note 사전 열은 사전 항목만 정렬해 순위를 매긴 뒤 순위로 기수 정렬합니다
+     */
+    std::vector<uint32_t> sortOrder(const std::vector<SortKey>& keys, size_t threads = 1) const;
+
+    /**
+     * @brief 키 순서대로 행을 정렬합니다
+     * @param keys 정렬 키들 (앞의 키가 우선)
+     * @param threads 문자열 병합 정렬 스레드 수 (0이면 CPU 코어 수)
+     * @throws std::runtime_error 열이 없을 때
+     *
+     * @note sortOrder()로 순열을 구한 뒤 열마다 오프셋/길이/타입 배열만 옮깁니다 (셀은 복사하지 않음)
+     */
+    void sortBy(const std::vector<SortKey>& keys, size_t threads = 1);
+
+    /**
+     * @brief 헤더 이름으로 열 인덱스를 찾습니다
+     * @param header_name 찾을 헤더 이름
+     * @return 열 인덱스
+     * @throws std::runtime_error 헤더를 찾지 못했을 때
+     */
+    size_t findColumn(const std::string& header_name) const;
+
+    /**
+     * @brief 열을 반환합니다
+     * @param col 열 인덱스
+     * @return 열 참조
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     */
+    const Column& column(size_t col) const;
+    Column& column(size_t col);
+
+    /**
+     * @brief 헤더 이름으로 열을 반환합니다
+     * @param header_name 찾을 헤더 이름
+     * @return 열 참조
+     * @throws std::runtime_error 헤더를 찾지 못했을 때
+     */
+    const Column& column(const std::string& header_name) const;
+
+    /**
+     * @brief 셀 값을 반환합니다
+     * @param row 행 인덱스
+     * @param col 열 인덱스
+     * @return 셀 내용을 가리키는 뷰
+     * @throws std::out_of_range 인덱스가 범위를 벗어날 때
+     */
+    std::string_view get(size_t row, size_t col) const;
+
+    /**
+     * @brief 행 개수를 반환합니다
+     * @return 행 개수
+     */
+    size_t rowCount() const;
+
+    /**
+     * @brief 열 개수를 반환합니다
+     * @return 열 개수
+     */
+    size_t colCount() const;
+
+    /**
+     * @brief 헤더 목록을 반환합니다
+     * @return 헤더 벡터
+     */
+    const std::vector<std::string>& headers() const;
+};
+
+template <>
+const ColumnBuffer<int64_t>& CSVTable::column<int64_t>(const std::string& header_name) const;
+
+template <>
+const ColumnBuffer<double>& CSVTable::column<double>(const std::string& header_name) const;
+
+} // namespace mylib
+
+#endif // CSV_TABLE_HPP
@@ -0,0 +1,98 @@
+#ifndef CSV_WRITER_HPP
+#define CSV_WRITER_HPP
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "cpp/mylib/CSVTable.hpp"
+
+namespace mylib {
+
+/**
+ * @brief CSV 쓰기 옵션
+ */
+struct WriteOptions {
+    size_t threads = 1;                 /**< 직렬화 스레드 수 (0이면 CPU 코어 수) */
+    size_t buffer_size = 1024 * 1024;   /**< 한 번에 파일에 쓰는 바이트 수 */
+};
+
+/**
+ * @brief 버퍼링 CSV 라이터 클래스
+ *
+ * 셀을 재사용하는 큰 버퍼에 직렬화하고 버퍼가 차면 한 번에 씁니다.
+ * `,` `"` 줄바꿈이 든 셀은 따옴표로 감싸고 안의 "는 ""로 씁니다 (RFC 4180).
+ * RAII 패턴으로 소멸 시 남은 버퍼를 쓰고 파일을 닫습니다.
+ *
+ * @example
+ * CSVWriter writer("out.csv");
+ * writer.writeRow(table.headers());
+ * writer.writeRow({"Kim, Minsu", "Seoul"});
+ */
+class CSVWriter {
+private:
+    std::ofstream file_;
+    std::string filename_;
+    std::vector<char> buffer_;
+    size_t used_;
+    WriteOptions options_;
+
+    char* reserve(size_t n);
+    void writeBytes(const char* data, size_t length);
+
+public:
+    /**
+     * @brief 파일을 만들어 엽니다 (기존 내용은 지움)
+     * @param filename 저장할 파일 경로
+     * @param options 쓰기 옵션
+     * @throws std::runtime_error 파일을 열 수 없을 때
+     */
+    explicit CSVWriter(const std::string& filename, const WriteOptions& options = WriteOptions());
+
+    /**
+     * @brief 소멸자 - 남은 버퍼를 쓰고 파일을 닫습니다 (오류는 무시, 확인하려면 close() 호출)
+     */
+    ~CSVWriter();
+
+    // 복사 생성자와 할당 연산자 삭제 (파일은 복사 불가)
+    CSVWriter(const CSVWriter&) = delete;
+    CSVWriter& operator=(const CSVWriter&) = delete;
+
+    /**
+     * @brief 한 행을 씁니다
+     * @param row 셀 값들
+     */
+    void writeRow(const std::vector<std::string_view>& row);
+
+    /**
+     * @brief 한 행을 씁니다
+     * @param row 셀 값들
+     */
+    void writeRow(const std::vector<std::string>& row);
+
+    /**
+     * @brief 테이블 전체(헤더 포함)를 씁니다
+     * @param table 쓸 테이블
+     *
+     * @note 숫자로 변환된 열은 값 배열에서 std::to_chars로 포맷합니다 (예: 88.0 → 88)
+     * @note options.threads가 1이 아니면 행 구간을 스레드별 버퍼에 나누어 직렬화하고 순서대로 씁니다
+     */
+    void writeTable(const CSVTable& table);
+
+    /**
+     * @brief 버퍼에 모인 내용을 파일에 씁니다
+     * @throws std::runtime_error 쓰기에 실패했을 때
+     */
+    void flush();
+
+    /**
+     * @brief 남은 버퍼를 쓰고 파일을 닫습니다
+     * @throws std::runtime_error 쓰기에 실패했을 때
+     */
+    void close();
+};
+
+} // namespace mylib
+
+#endif // CSV_WRITER_HPP
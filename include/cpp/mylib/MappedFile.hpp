@@ -0,0 +1,173 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+namespace mylib {
+
+/**
+ * @brief 파일 식별자 (경로가 같아도 교체된 파일이면 달라짐)
+ *
+ * POSIX는 장치 번호 + inode, Windows는 볼륨 일련번호 + 파일 인덱스입니다.
+ */
+struct FileIdentity {
+    uint64_t device = 0;  /**< 장치 (볼륨) */
+    uint64_t inode = 0;   /**< 장치 안의 파일 번호 */
+
+    bool operator==(const FileIdentity& other) const {
+        return device == other.device && inode == other.inode;
+    }
+    bool operator!=(const FileIdentity& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief 매핑을 읽는 방식 (커널 read-ahead 힌트)
+ */
+enum class AccessPattern {
+    Sequential,  /**< 앞에서부터 한 번 훑음 (read-ahead를 키우고 읽은 페이지는 일찍 내보냄) */
+    Random,      /**< 흩어진 위치를 읽음 (read-ahead 끔) */
+    Normal       /**< 힌트 없음 (커널 기본값) */
+};
+
+/**
+ * @brief 메모리 매핑 파일 클래스
+ *
+ * 파일 전체를 프로세스 주소 공간에 매핑합니다.
+ * copy-on-write로 매핑하면 내용을 수정할 수 있으며, 수정된 페이지만
+ * 프로세스 전용으로 복사되고 원본 파일에는 반영되지 않습니다.
+ * RAII 패턴으로 소멸 시 자동으로 매핑을 해제합니다.
+ *
+ * @note 빈 파일은 매핑하지 않으며 data()가 nullptr, size()가 0입니다
+ */
+class MappedFile {
+private:
+    char* data_;
+    size_t size_;
+    bool writable_;
+    FileIdentity identity_;
+#ifdef _WIN32
+    void* file_handle_;
+    void* mapping_handle_;
+#endif
+
+    void release();
+
+public:
+    /**
+     * @brief 파일을 매핑합니다
+     * @param filename 매핑할 파일 경로
+     * @param copy_on_write true면 수정 가능한 private 매핑을 만듭니다
+     * @param access 매핑을 읽는 방식 (POSIX madvise, Windows 파일 열기 플래그)
+     * @throws std::runtime_error 파일을 열거나 매핑할 수 없을 때
+     */
+    explicit MappedFile(const std::string& filename, bool copy_on_write = false,
+                        AccessPattern access = AccessPattern::Sequential);
+
+    /**
+     * @brief 소멸자 - 자동으로 매핑 해제
+     */
+    ~MappedFile();
+
+    // 복사 생성자와 할당 연산자 삭제 (매핑은 복사 불가)
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // 이동 생성자와 할당 연산자
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief 매핑된 데이터의 시작 주소를 반환합니다
+     * @return 데이터 포인터 (빈 파일이면 nullptr)
+     */
+    const char* data() const;
+
+    /**
+     * @brief 수정 가능한 데이터 주소를 반환합니다
+     * @return 데이터 포인터 (copy-on-write 매핑이 아니거나 빈 파일이면 nullptr)
+     */
+    char* writableData();
+
+    /**
+     * @brief 매핑된 바이트 수를 반환합니다
+     * @return 파일 크기
+     */
+    size_t size() const;
+
+    /**
+     * @brief 매핑 전체를 문자열 뷰로 반환합니다
+     * @return 파일 내용 뷰
+     */
+    std::string_view view() const;
+
+    /**
+     * @brief 매핑한 파일의 식별자를 반환합니다 (열었을 때 기준)
+     * @return 파일 식별자
+     */
+    const FileIdentity& identity() const;
+};
+
+/**
+ * @brief 위치 지정 읽기(pread) 파일 클래스
+ *
+ * 매핑하지 않고 필요한 구간만 버퍼로 복사합니다. 다른 프로세스가 쓰는 중인 파일을
+ * 매핑하면 그 사이 파일이 잘렸을 때 새 끝 너머 페이지를 만지는 순간 SIGBUS가 나지만,
+ * 읽기는 그때까지 있는 바이트만 돌려주므로 안전합니다 (이어 읽기용).
+ * RAII 패턴으로 소멸 시 자동으로 파일을 닫습니다.
+ */
+class FileReader {
+private:
+    uint64_t size_;
+    FileIdentity identity_;
+#ifdef _WIN32
+    void* handle_;
+#else
+    int fd_;
+#endif
+
+public:
+    /**
+     * @brief 파일을 엽니다
+     * @param filename 파일 경로
+     * @throws std::runtime_error 파일을 열 수 없을 때
+     */
+    explicit FileReader(const std::string& filename);
+
+    /**
+     * @brief 소멸자 - 자동으로 파일을 닫음
+     */
+    ~FileReader();
+
+    // 복사/이동 불가 (한 곳에서 열고 닫음)
+    FileReader(const FileReader&) = delete;
+    FileReader& operator=(const FileReader&) = delete;
+
+    /**
+     * @brief 열었을 때의 파일 크기를 반환합니다
+     * @return 바이트 수
+     */
+    uint64_t size() const { return size_; }
+
+    /**
+     * @brief 연 파일의 식별자를 반환합니다
+     * @return 파일 식별자
+     */
+    const FileIdentity& identity() const { return identity_; }
+
+    /**
+     * @brief [offset, offset + length) 구간을 읽습니다
+     * @param offset 파일 위치
+     * @param dst 받을 버퍼 (length 바이트)
+     * @param length 읽을 바이트 수
+     * @return 읽은 바이트 수 (그 사이 파일이 잘렸으면 length보다 작음)
+     * @throws std::runtime_error 읽기에 실패했을 때
+     */
+    size_t read(uint64_t offset, char* dst, size_t length) const;
+};
+
+} // namespace mylib
+
+#endif // MAPPED_FILE_HPP
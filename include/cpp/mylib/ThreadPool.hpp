@@ -0,0 +1,78 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace mylib {
+
+/**
+ * @brief 고정 크기 스레드 풀 클래스
+ *
+ * 생성 시 작업자 스레드를 만들고, 소멸 시 남은 작업을 모두 처리한 뒤 join합니다.
+ * RAII 패턴으로 스레드 수명을 자동 관리합니다.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::packaged_task<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stopping_;
+
+    void workerLoop();
+
+public:
+    /**
+     * @brief 스레드 풀을 생성합니다
+     * @param threads 작업자 스레드 수 (0이면 defaultThreadCount())
+     */
+    explicit ThreadPool(size_t threads = 0);
+
+    /**
+     * @brief 소멸자 - 대기 중인 작업을 마치고 모든 스레드를 join
+     */
+    ~ThreadPool();
+
+    // 복사/이동 금지 (작업자 스레드가 this를 참조)
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief 작업을 큐에 넣습니다
+     * @param task 실행할 작업
+     * @return 작업 완료를 기다릴 future (작업의 예외는 get()에서 다시 던져짐)
+     */
+    std::future<void> submit(std::function<void()> task);
+
+    /**
+     * @brief [0, count) 각 인덱스에 대해 fn을 병렬로 실행하고 모두 끝날 때까지 기다립니다
+     * @param count 작업 개수
+     * @param fn 인덱스를 받는 작업 함수
+     *
+     * @note 작업 중 예외가 발생하면 모든 작업이 끝난 뒤 첫 번째 예외를 다시 던집니다
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+    /**
+     * @brief 작업자 스레드 수를 반환합니다
+     * @return 스레드 수
+     */
+    size_t size() const;
+
+    /**
+     * @brief 하드웨어 스레드 수를 반환합니다
+     * @return std::thread::hardware_concurrency() (알 수 없으면 1)
+     */
+    static size_t defaultThreadCount();
+};
+
+} // namespace mylib
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,83 @@
+#ifndef CSV_ARENA_H
+#define CSV_ARENA_H
+
+#include <stddef.h>  /* size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 아레나 메모리 블록 (내부용)
+ */
+typedef struct CSVArenaBlock CSVArenaBlock;
+
+/**
+ * @brief 범프(bump) 아레나 할당기
+ *
+ * 큰 블록을 한 번에 할당한 뒤 앞에서부터 잘라 씁니다.
+ * 개별 해제는 없고 csv_arena_free()가 블록 단위로 한꺼번에 해제하므로
+ * 해제 비용은 할당 횟수가 아니라 블록 개수에 비례합니다.
+ *
+ * @note 스레드 안전하지 않습니다. 스레드마다 아레나를 따로 두고
+ *       csv_arena_merge()로 합치세요
+ */
+typedef struct {
+    CSVArenaBlock *head;  /**< 현재 블록 (블록 목록의 머리) */
+    char *cursor;         /**< 현재 블록의 다음 할당 위치 */
+    char *limit;          /**< 현재 블록의 끝 */
+} CSVArena;
+
+/**
+ * @brief 빈 아레나로 초기화합니다 (첫 할당 때 블록을 만듦)
+ * @param arena 아레나
+ */
+void csv_arena_init(CSVArena *arena);
+
+/**
+ * @brief 아레나에서 메모리를 할당합니다
+ * @param arena 아레나
+ * @param size 바이트 수
+ * @param align 정렬 (2의 거듭제곱, 최대 16)
+ * @return 할당된 메모리, 실패 시 NULL
+ *
+ * @note 블록 크기보다 큰 요청은 전용 블록을 만듭니다
+ */
+void* csv_arena_alloc(CSVArena *arena, size_t size, size_t align);
+
+/**
+ * @brief 문자열을 아레나에 복사하고 NUL 종료합니다
+ * @param arena 아레나
+ * @param str 복사할 문자열
+ * @param length 복사할 길이
+ * @return 복사본, 실패 시 NULL
+ */
+char* csv_arena_strndup(CSVArena *arena, const char *str, size_t length);
+
+/**
+ * @brief src의 블록을 모두 dst로 옮깁니다
+ * @param dst 블록을 받을 아레나
+ * @param src 비워질 아레나 (이후 빈 아레나로 재사용 가능)
+ *
+ * @note 블록 포인터만 옮기므로 src에서 할당한 메모리는 그대로 유효합니다
+ */
+void csv_arena_merge(CSVArena *dst, CSVArena *src);
+
+/**
+ * @brief 아레나의 모든 블록을 해제합니다
+ * @param arena 아레나 (NULL 가능, 이후 빈 아레나로 재사용 가능)
+ */
+void csv_arena_free(CSVArena *arena);
+
+/**
+ * @brief 아레나가 가진 블록 개수를 반환합니다
+ * @param arena 아레나
+ * @return 블록 개수
+ */
+size_t csv_arena_block_count(const CSVArena *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_ARENA_H */
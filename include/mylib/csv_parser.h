@@ -2,18 +2,31 @@
 #define CSV_PARSER_H
 
 #include <stddef.h>  /* size_t */
+#include "mylib/csv_arena.h"      /* CSVArena */
+#include "mylib/csv_readahead.h"  /* CSVReadAheadStats */
+#include "mylib/csv_tokenizer.h"  /* CSVRecord */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /**
  * @brief CSV 데이터 구조체
  *
  * CSV 파일의 데이터를 메모리에 저장합니다.
  * 첫 번째 행은 헤더(컬럼 이름)로 간주됩니다.
+ *
+ * 헤더, 행별 필드 배열, 셀 문자열은 모두 arena의 큰 블록에서 잘라 쓰므로
+ * csv_destroy()는 셀 개수와 관계없이 블록 개수만큼만 free를 호출합니다.
  */
 typedef struct {
     char **headers;      /**< 헤더 행 (컬럼 이름 배열) */
     char ***rows;        /**< 데이터 행들 (2차원 문자열 배열) */
     size_t row_count;    /**< 데이터 행 개수 (헤더 제외) */
     size_t col_count;    /**< 열(컬럼) 개수 */
+    CSVArena arena;      /**< 헤더/행/셀 메모리를 소유하는 아레나 (내부용) */
+    void *snapshot;      /**< csv_load_binary()가 매핑한 스냅샷 파일, 없으면 NULL (내부용) */
+    size_t snapshot_size; /**< 스냅샷 매핑 크기 (내부용) */
 } CSVData;
 
 /**
@@ -33,6 +46,130 @@ typedef struct {
  */
 CSVData* csv_parse(const char *filename);
 
+/**
+ * @brief 지정한 열만 파싱합니다 (프로젝션)
+ * @param filename 읽을 CSV 파일 경로
+ * @param columns 읽을 열 이름 배열 (결과의 열 순서)
+ * @param column_count 열 이름 개수 (0이면 csv_parse()와 같음)
+ * @return 선택한 열만 담은 CSV 데이터, 실패 시 NULL (열 이름을 찾지 못한 경우 포함)
+ *
+ * @note 열 이름은 헤더에서 한 번만 찾습니다. 빠진 열의 필드는 구분자 위치만 찾고
+ *       복사/할당하지 않으므로 메모리 사용량은 선택한 열 수에 비례합니다
+ *
+ * @example
+ * const char *columns[] = { "name", "score" };
+ * CSVData *data = csv_parse_columns("data.csv", columns, 2);
+ */
+CSVData* csv_parse_columns(const char *filename, const char *const *columns, size_t column_count);
+
+/**
+ * @brief CSV 파일을 여러 스레드로 나누어 파싱합니다
+ * @param filename 읽을 CSV 파일 경로
+ * @param num_threads 사용할 스레드 수 (0이면 CPU 코어 수)
+ * @return 파싱된 CSV 데이터, 실패 시 NULL
+ *
+ * @note 파일을 바이트 구간으로 나눈 뒤 따옴표 상태를 고려해 레코드 경계에 맞춥니다.
+ *       결과는 csv_parse()와 같은 행 순서를 가지며 csv_destroy()로 해제합니다.
+ * @note 작은 파일은 스레드 수보다 적은 구간으로 나누어질 수 있습니다
+ */
+CSVData* csv_parse_parallel(const char *filename, size_t num_threads);
+
+/**
+ * @brief CSV 스트림 (한 행씩 읽는 리더, 불투명 타입)
+ *
+ * 파일 전체를 메모리에 올리지 않고 블록 단위로 읽으며 행 버퍼를 재사용합니다.
+ * 메모리 사용량은 파일 크기가 아니라 가장 긴 행의 길이에 비례합니다
+ * (미리 읽기 링 4MiB는 별도).
+ */
+typedef struct CSVStream CSVStream;
+
+/**
+ * @brief 행 콜백 함수 타입
+ * @param fields 행의 필드 배열 (콜백이 반환되면 무효화됨)
+ * @param field_count 필드 개수
+ * @param user csv_parse_stream()에 전달한 사용자 데이터
+ * @return 0이면 계속, 0이 아니면 중단
+ */
+typedef int (*CSVRowCallback)(char **fields, size_t field_count, void *user);
+
+/**
+ * @brief CSV 파일을 스트림으로 엽니다
+ * @param filename 읽을 CSV 파일 경로
+ * @return 스트림, 실패 시 NULL
+ *
+ * @note 첫 번째 행은 헤더로 읽어 csv_stream_headers()로 제공합니다
+ * @note 사용 후 반드시 csv_stream_close()로 닫아야 합니다
+ *
+ * @example
+ * CSVStream *stream = csv_stream_open("data.csv");
+ * char **fields;
+ * size_t count;
+ * while (csv_stream_next(stream, &fields, &count) == 1) {
+ *     // fields는 다음 csv_stream_next() 호출 전까지 유효
+ * }
+ * csv_stream_close(stream);
+ */
+CSVStream* csv_stream_open(const char *filename);
+
+/**
+ * @brief 헤더 행을 반환합니다
+ * @param stream 스트림
+ * @param count 헤더 개수를 저장할 포인터 (NULL 가능)
+ * @return 헤더 배열 (스트림이 닫힐 때까지 유효), 헤더가 없으면 NULL
+ */
+char** csv_stream_headers(const CSVStream *stream, size_t *count);
+
+/**
+ * @brief 다음 데이터 행을 읽습니다
+ * @param stream 스트림
+ * @param fields 필드 배열을 받을 포인터
+ * @param count 필드 개수를 받을 포인터
+ * @return 1: 행을 읽음, 0: 파일 끝, -1: 실패
+ *
+ * @note 필드는 내부 버퍼를 가리키므로 다음 호출 시 무효화됩니다.
+ *       계속 보관하려면 복사해야 합니다
+ */
+int csv_stream_next(CSVStream *stream, char ***fields, size_t *count);
+
+/**
+ * @brief 다음 데이터 행을 토큰화만 하고 원본 필드 구간으로 돌려줍니다
+ * @param stream 스트림
+ * @param record 레코드 포인터를 받을 포인터
+ * @return 1: 행을 읽음, 0: 파일 끝, -1: 실패
+ *
+ * @note 필드는 따옴표가 풀리지 않은 상태입니다. 필드 내용은 다음 호출 전까지
+ *       수정해도 되므로 csv_field_decode()로 제자리 복원할 수 있습니다
+ */
+int csv_stream_next_record(CSVStream *stream, const CSVRecord **record);
+
+/**
+ * @brief 스트림의 읽기 통계를 가져옵니다
+ * @param stream 스트림
+ * @param stats 통계를 받을 구조체
+ * @return 성공 시 0, 실패 시 -1
+ *
+ * @note 스트림은 생산자 스레드가 블록을 미리 읽어 두므로(csv_readahead.h) 읽기와 토큰화가 겹칩니다.
+ *       consumer_stall_ns가 크면 I/O가, producer_stall_ns가 크면 파싱이 병목입니다
+ */
+int csv_stream_io_stats(const CSVStream *stream, CSVReadAheadStats *stats);
+
+/**
+ * @brief 스트림을 닫고 메모리를 해제합니다
+ * @param stream 스트림 (NULL 가능)
+ */
+void csv_stream_close(CSVStream *stream);
+
+/**
+ * @brief CSV 파일의 데이터 행을 하나씩 콜백으로 전달합니다
+ * @param filename 읽을 CSV 파일 경로
+ * @param callback 행마다 호출할 함수
+ * @param user 콜백에 그대로 전달할 사용자 데이터
+ * @return 0: 끝까지 읽음, 1: 콜백이 중단함, -1: 실패
+ *
+ * @note 헤더 행은 콜백에 전달하지 않습니다
+ */
+int csv_parse_stream(const char *filename, CSVRowCallback callback, void *user);
+
 /**
  * @brief 특정 셀의 값을 가져옵니다
  * @param data CSV 데이터
@@ -76,9 +213,33 @@ void csv_print(const CSVData *data);
  * @param data CSV 데이터
  * @param filename 저장할 파일 경로
  * @return 성공 시 0, 실패 시 -1
+ *
+ * @note `,` `"` 줄바꿈이 든 셀은 따옴표로 감싸고 안의 "는 ""로 씁니다 (RFC 4180)
+ * @note 1 MiB 버퍼에 모아 한 번에 쓰므로 셀 개수만큼 입출력 호출을 하지 않습니다
  */
 int csv_write(const CSVData *data, const char *filename);
 
+/**
+ * @brief CSV 데이터를 바이너리 스냅샷으로 저장합니다
+ * @param data CSV 데이터
+ * @param filename 저장할 파일 경로
+ * @return 성공 시 0, 실패 시 -1
+ *
+ * @note 형식은 mylib/csv_snapshot.h 참고 (C++ CSVParser::loadSnapshot()으로도 읽을 수 있음)
+ */
+int csv_save_binary(const CSVData *data, const char *filename);
+
+/**
+ * @brief 바이너리 스냅샷을 메모리 매핑으로 불러옵니다
+ * @param filename 스냅샷 파일 경로
+ * @param verify_checksum 0이 아니면 본문 체크섬까지 검사 (파일 전체를 읽음)
+ * @return CSV 데이터, 형식이 맞지 않거나 손상되었으면 NULL
+ *
+ * @note 셀 문자열은 복사하지 않고 매핑된 파일을 가리킵니다 (행 포인터 배열만 만듦)
+ * @note 사용 후 반드시 csv_destroy()로 해제해야 하며, 그때 매핑도 해제됩니다
+ */
+CSVData* csv_load_binary(const char *filename, int verify_checksum);
+
 /**
  * @brief CSV 데이터의 행 개수를 반환합니다
  * @param data CSV 데이터
@@ -101,4 +262,8 @@ size_t csv_col_count(const CSVData *data);
  */
 void csv_destroy(CSVData *data);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* CSV_PARSER_H */
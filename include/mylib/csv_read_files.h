@@ -0,0 +1,66 @@
+#ifndef CSV_READ_FILES_H
+#define CSV_READ_FILES_H
+
+#include <stddef.h>  /* size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 여러 파일을 한꺼번에 메모리로 읽기 (작은 파일 대량 수집용)
+ *
+ * 파일마다 open → fstat → read → close를 차례로 부르면 작은 파일 수천 개에서는
+ * 시스템 호출 왕복이 파싱보다 오래 걸립니다. Linux에서 io_uring을 쓸 수 있으면
+ * 묶음(최대 CSV_READ_FILES_BATCH개)마다 열기+크기 조회, 읽기, 닫기를 각각 한 번의
+ * io_uring_enter로 제출합니다. 쓸 수 없으면(커널이 오래됐거나 seccomp로 막힘,
+ * Linux가 아님) 파일마다 일반 읽기로 대체하며 결과는 같습니다.
+ */
+
+#define CSV_READ_FILES_BATCH 64  /**< io_uring 한 묶음의 파일 수 */
+
+/** @brief csv_read_files() 플래그 */
+enum {
+    CSV_READ_AUTO = 0,   /**< io_uring을 쓸 수 있으면 사용 */
+    CSV_READ_PLAIN = 1   /**< 항상 일반 읽기 (비교/디버깅용) */
+};
+
+/**
+ * @brief 파일 하나의 읽기 결과
+ */
+typedef struct {
+    char *data;    /**< 파일 내용 + NUL (csv_file_buffers_free()로 해제), 실패 시 NULL */
+    size_t size;   /**< 읽은 바이트 수 (NUL 제외) */
+    int error;     /**< 0이면 성공, 아니면 errno 값 */
+} CSVFileBuffer;
+
+/**
+ * @brief 여러 파일을 읽습니다
+ * @param paths 파일 경로 배열
+ * @param count 파일 개수
+ * @param out 결과를 받을 배열 (count개, 호출 전 내용은 무시)
+ * @param flags CSV_READ_AUTO 또는 CSV_READ_PLAIN
+ * @return 실패한 파일 수 (모두 성공하면 0), 인자가 잘못되면 -1
+ *
+ * @note 한 파일이 실패해도 나머지는 계속 읽습니다 (out[i].error 확인)
+ */
+int csv_read_files(const char *const *paths, size_t count, CSVFileBuffer *out, int flags);
+
+/**
+ * @brief csv_read_files()가 읽은 버퍼들을 해제합니다
+ * @param buffers 결과 배열
+ * @param count 개수
+ */
+void csv_file_buffers_free(CSVFileBuffer *buffers, size_t count);
+
+/**
+ * @brief CSV_READ_AUTO일 때 쓰는 방식의 이름을 반환합니다
+ * @return "io_uring" 또는 "plain"
+ */
+const char* csv_read_files_backend(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_READ_FILES_H */
@@ -0,0 +1,83 @@
+#ifndef CSV_READAHEAD_H
+#define CSV_READAHEAD_H
+
+#include <stddef.h>  /* size_t */
+#include <stdint.h>  /* uint64_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 미리 읽기 리더 (불투명 타입)
+ *
+ * 생산자 스레드가 블록 링(depth개 × block_size)을 파일 앞에서부터 pread로 채우고,
+ * 소비자(토크나이저)는 채워진 블록을 꺼내 씁니다. 읽기와 파싱이 겹치므로
+ * 네트워크 파일시스템이나 캐시에 없는 디스크에서도 파서가 I/O를 기다리는 시간이 줄어듭니다.
+ *
+ * 파일이 블록 하나보다 작거나 스레드를 만들 수 없으면 호출한 스레드에서 바로 읽습니다
+ * (결과는 같고 겹치기만 없음).
+ */
+typedef struct CSVReadAhead CSVReadAhead;
+
+/**
+ * @brief 미리 읽기 통계
+ *
+ * 생산자 대기가 길면 파싱이 병목이고, 소비자 대기가 길면 I/O가 병목입니다.
+ */
+typedef struct {
+    uint64_t bytes_read;          /**< 파일에서 읽은 바이트 수 */
+    uint64_t blocks_read;         /**< 채운 블록 수 */
+    uint64_t producer_stall_ns;   /**< 생산자가 빈 블록을 기다린 시간 (링이 가득 참) */
+    uint64_t consumer_stall_ns;   /**< 소비자가 채워진 블록을 기다린 시간 (읽기가 늦음) */
+    int threaded;                 /**< 생산자 스레드를 썼으면 1 */
+} CSVReadAheadStats;
+
+/**
+ * @brief 파일을 열고 미리 읽기를 시작합니다
+ * @param filename 읽을 파일 경로
+ * @param block_size 블록 하나의 바이트 수 (0이면 1MiB)
+ * @param depth 링의 블록 개수 (2 미만이면 2)
+ * @return 리더, 실패 시 NULL
+ *
+ * @note 커널에 순차 접근을 알려(posix_fadvise SEQUENTIAL) 커널 read-ahead도 키웁니다
+ * @note 사용 후 반드시 csv_readahead_close()로 닫아야 합니다
+ */
+CSVReadAhead* csv_readahead_open(const char *filename, size_t block_size, size_t depth);
+
+/**
+ * @brief 다음 바이트들을 dst로 복사합니다 (fread와 같은 의미)
+ * @param reader 리더
+ * @param dst 받을 버퍼
+ * @param size 읽을 최대 바이트 수
+ * @return 복사한 바이트 수 (size보다 작으면 파일 끝 또는 오류)
+ *
+ * @note 채워진 블록이 없으면 생산자가 채울 때까지 기다립니다 (소비자 대기 시간에 누적)
+ */
+size_t csv_readahead_read(CSVReadAhead *reader, void *dst, size_t size);
+
+/**
+ * @brief 읽기 오류가 있었는지 확인합니다
+ * @param reader 리더
+ * @return 오류가 있었으면 1, 없으면 0
+ */
+int csv_readahead_error(const CSVReadAhead *reader);
+
+/**
+ * @brief 지금까지의 통계를 가져옵니다
+ * @param reader 리더
+ * @param stats 통계를 받을 구조체
+ */
+void csv_readahead_stats(const CSVReadAhead *reader, CSVReadAheadStats *stats);
+
+/**
+ * @brief 생산자 스레드를 멈추고 파일과 버퍼를 해제합니다
+ * @param reader 리더 (NULL 가능)
+ */
+void csv_readahead_close(CSVReadAhead *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_READAHEAD_H */
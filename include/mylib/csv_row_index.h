@@ -0,0 +1,75 @@
+#ifndef CSV_ROW_INDEX_H
+#define CSV_ROW_INDEX_H
+
+#include <stddef.h>  /* size_t */
+#include <stdint.h>  /* uint64_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 행 위치 색인 파일 형식 (C/C++ 공용)
+ *
+ * 큰 CSV 옆에 두는 작은 사이드카 파일로, stride행마다 레코드 시작 바이트 오프셋을
+ * 저장합니다. 행 i를 읽을 때는 offsets[i / stride]로 바로 이동한 뒤 많아야
+ * stride - 1개의 레코드만 건너뛰면 되므로 앞의 행을 모두 스캔하지 않아도 됩니다.
+ * 원본 파일의 크기와 수정 시각(지문)을 함께 저장하여, 원본이 바뀌면 색인을 쓰지 않습니다.
+ * 정수는 저장한 기계의 바이트 순서이며 byte_order 표식이 다르면 읽지 않습니다.
+ *
+ * 배치: CSVRowIndexHeader (64바이트) + uint64 offsets[ceil(row_count / stride)]
+ */
+
+#define CSV_ROW_INDEX_MAGIC "CSVRIDX"        /**< 8바이트 (NUL 포함) */
+#define CSV_ROW_INDEX_VERSION 1u
+#define CSV_ROW_INDEX_BYTE_ORDER 0x01020304u
+
+/**
+ * @brief 색인 파일 머리 (64바이트)
+ */
+typedef struct {
+    char magic[8];                 /**< CSV_ROW_INDEX_MAGIC */
+    uint32_t version;              /**< CSV_ROW_INDEX_VERSION */
+    uint32_t byte_order;           /**< CSV_ROW_INDEX_BYTE_ORDER */
+    uint64_t source_size;          /**< 원본 CSV 크기 (지문) */
+    uint64_t source_mtime;         /**< 원본 CSV 수정 시각, 나노초 (지문) */
+    uint64_t stride;               /**< 오프셋을 저장한 행 간격 (1 이상) */
+    uint64_t row_count;            /**< 데이터 행 개수 (헤더 제외) */
+    uint64_t data_begin;           /**< 헤더 줄 바로 뒤 오프셋 */
+    uint64_t checksum;             /**< 머리(이 필드는 0으로 보고) + 오프셋 배열의 체크섬 */
+} CSVRowIndexHeader;
+
+/**
+ * @brief 파일의 지문(크기와 수정 시각)을 구합니다
+ * @param filename 파일 경로
+ * @param size 크기를 저장할 포인터
+ * @param mtime 수정 시각(나노초)을 저장할 포인터
+ * @return 성공 시 0, 실패 시 -1
+ */
+int csv_row_index_fingerprint(const char *filename, uint64_t *size, uint64_t *mtime);
+
+/**
+ * @brief 색인 파일을 저장합니다
+ * @param filename 저장할 파일 경로
+ * @param header source_size/source_mtime/stride/row_count/data_begin을 채운 머리
+ *               (magic/version/byte_order/checksum은 이 함수가 채움)
+ * @param offsets stride행마다의 레코드 시작 오프셋 (ceil(row_count / stride)개)
+ * @return 성공 시 0, 실패 시 -1 (쓰다 실패하면 파일을 지움)
+ */
+int csv_row_index_write(const char *filename, const CSVRowIndexHeader *header, const uint64_t *offsets);
+
+/**
+ * @brief 매핑한 색인 파일의 형식, 크기, 체크섬, 오프셋 순서를 검사합니다
+ * @param data 파일 내용
+ * @param size 파일 크기
+ * @return 올바르면 0, 아니면 -1
+ *
+ * @note 지문 비교는 하지 않습니다 (호출자가 원본의 지문과 비교)
+ */
+int csv_row_index_validate(const void *data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_ROW_INDEX_H */
@@ -0,0 +1,104 @@
+#ifndef CSV_SCAN_H
+#define CSV_SCAN_H
+
+#include <stddef.h>  /* size_t */
+#include <stdint.h>  /* uint64_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief CSV 특수 문자 스캐너
+ *
+ * 입력을 64바이트 블록 단위로 읽어 ',', '"', '\r', '\n' 위치를
+ * 64비트 마스크로 만든 뒤 비트를 하나씩 꺼내 다음 특수 문자 위치를 돌려줍니다.
+ * 블록 마스크는 SIMD(SSE2 기본, 가능하면 AVX2를 런타임에 선택)로 계산합니다.
+ *
+ * @note C 파서와 C++ 파서가 공유합니다
+ */
+typedef struct {
+    const char *data;    /**< 스캔할 버퍼 */
+    size_t len;          /**< 버퍼 길이 */
+    size_t block;        /**< 현재 블록의 시작 오프셋 */
+    uint64_t mask;       /**< 현재 블록에서 아직 돌려주지 않은 특수 문자 비트 */
+} CSVScanner;
+
+/**
+ * @brief 스캐너를 초기화합니다
+ * @param sc 스캐너
+ * @param data 스캔할 버퍼
+ * @param len 버퍼 길이
+ */
+void csv_scanner_init(CSVScanner *sc, const char *data, size_t len);
+
+/**
+ * @brief 다음 특수 문자의 위치를 반환합니다
+ * @param sc 스캐너
+ * @return 특수 문자의 오프셋, 더 이상 없으면 len
+ */
+size_t csv_scanner_next(CSVScanner *sc);
+
+/**
+ * @brief pos 이상의 위치부터 스캔을 계속하도록 이동합니다
+ * @param sc 스캐너
+ * @param pos 새 시작 오프셋 (len 이하)
+ */
+void csv_scanner_seek(CSVScanner *sc, size_t pos);
+
+/**
+ * @brief 버퍼에서 첫 번째 특수 문자 위치를 찾습니다
+ * @param data 버퍼
+ * @param len 버퍼 길이
+ * @return 특수 문자의 오프셋, 없으면 len
+ */
+size_t csv_scan_special(const char *data, size_t len);
+
+/**
+ * @brief 버퍼에 포함된 따옴표(")의 개수를 셉니다
+ * @param data 버퍼
+ * @param len 버퍼 길이
+ * @return 따옴표 개수
+ *
+ * @note 개수의 홀짝으로 버퍼 끝이 따옴표 안인지 알 수 있습니다 (청크 분할용)
+ */
+size_t csv_scan_count_quotes(const char *data, size_t len);
+
+/**
+ * @brief from 이후 따옴표 밖의 첫 줄 끝 바로 다음 위치를 찾습니다
+ * @param data 버퍼
+ * @param len 버퍼 길이
+ * @param from 스캔 시작 오프셋
+ * @param in_quotes from 위치가 따옴표 안이면 1
+ * @return 다음 레코드의 시작 오프셋, 줄 끝이 없으면 len
+ */
+size_t csv_scan_record_end(const char *data, size_t len, size_t from, int in_quotes);
+
+/**
+ * @brief 따옴표 밖 줄 끝 다음의 레코드 시작 위치들을 찾습니다 (행 위치 색인용)
+ * @param data 버퍼
+ * @param len 버퍼 길이 (이 앞까지만 스캔)
+ * @param pos 스캔 시작 오프셋 (입력), 이어서 스캔할 오프셋 (출력, 끝까지 스캔했으면 len)
+ * @param in_quotes *pos 위치가 따옴표 안이면 1 (입력), 출력 *pos 위치의 상태 (출력)
+ * @param starts 레코드 시작 오프셋을 받을 배열
+ * @param capacity starts 크기 (1 이상)
+ * @return 기록한 개수 (capacity가 차면 멈추고, *pos부터 다시 부르면 이어서 찾음)
+ *
+ * @note 블록마다 따옴표/줄 끝 마스크를 SIMD로 구하고, 따옴표 마스크의 누적 XOR로
+ *       따옴표 안의 줄 끝을 한 번에 지웁니다 (memchr 한 번과 비슷한 속도)
+ * @note 빈 줄과 "\r\n"의 '\r' 뒤는 레코드 시작으로 보지 않으므로 토크나이저의 행 구분과 같습니다
+ */
+size_t csv_scan_record_starts(const char *data, size_t len, size_t *pos, int *in_quotes,
+                              uint64_t *starts, size_t capacity);
+
+/**
+ * @brief 런타임에 선택된 스캔 구현의 이름을 반환합니다
+ * @return "avx2", "sse2" 또는 "scalar"
+ */
+const char* csv_scan_backend(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_SCAN_H */
@@ -0,0 +1,142 @@
+#ifndef CSV_SNAPSHOT_H
+#define CSV_SNAPSHOT_H
+
+#include <stddef.h>  /* size_t */
+#include <stdint.h>  /* uint64_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 바이너리 스냅샷 파일 형식 (C/C++ 공용)
+ *
+ * 파싱된 테이블을 열 단위로 저장하여, 파일을 매핑하기만 하면 역직렬화 없이
+ * 바로 셀에 접근할 수 있게 합니다. 모든 정수는 저장한 기계의 바이트 순서이며
+ * byte_order 표식이 다르면 읽지 않습니다.
+ *
+ * 배치 (배열은 8바이트 정렬):
+ * - CSVSnapshotHeader (64바이트)
+ * - CSVSnapshotColumn × col_count (각 64바이트)
+ * - 열 이름들 (각각 NUL 종료)
+ * - 열마다: 셀 힙 (셀마다 NUL 종료) / uint64 offsets[rows] / uint32 lengths[rows]
+ *           / 타입 배열 int64 또는 double [rows] (숫자 열만)
+ *
+ * 셀이 NUL 종료되어 있으므로 C는 힙을 가리키는 char*를, C++은 오프셋/길이 배열을
+ * 그대로 사용합니다.
+ */
+
+#define CSV_SNAPSHOT_MAGIC "CSVSNAP"          /**< 8바이트 (NUL 포함) */
+#define CSV_SNAPSHOT_VERSION 1u
+#define CSV_SNAPSHOT_BYTE_ORDER 0x01020304u
+
+/** @brief 열 값 타입 (C++ ColumnType과 같은 순서) */
+enum {
+    CSV_SNAPSHOT_STRING = 0,
+    CSV_SNAPSHOT_INT64 = 1,
+    CSV_SNAPSHOT_DOUBLE = 2
+};
+
+/**
+ * @brief 스냅샷 파일 머리 (64바이트)
+ */
+typedef struct {
+    char magic[8];                 /**< CSV_SNAPSHOT_MAGIC */
+    uint32_t version;              /**< CSV_SNAPSHOT_VERSION */
+    uint32_t byte_order;           /**< CSV_SNAPSHOT_BYTE_ORDER */
+    uint64_t row_count;
+    uint64_t col_count;
+    uint64_t file_size;            /**< 파일 전체 크기 */
+    uint64_t directory_checksum;   /**< 머리(체크섬 필드는 0으로 보고) + 열 목록의 체크섬 */
+    uint64_t payload_checksum;     /**< 열 목록 뒤부터 파일 끝까지의 체크섬 */
+    uint64_t reserved;
+} CSVSnapshotHeader;
+
+/**
+ * @brief 열 목록 항목 (64바이트, 오프셋은 파일 시작 기준)
+ */
+typedef struct {
+    uint64_t name_offset;
+    uint64_t name_length;
+    uint32_t type;                 /**< CSV_SNAPSHOT_STRING / INT64 / DOUBLE */
+    uint32_t reserved;
+    uint64_t heap_offset;          /**< 셀 힙 시작 (셀 오프셋의 기준) */
+    uint64_t heap_size;
+    uint64_t offsets_offset;       /**< uint64_t[row_count] */
+    uint64_t lengths_offset;       /**< uint32_t[row_count] */
+    uint64_t values_offset;        /**< int64_t/double[row_count], 문자열 열은 0 */
+} CSVSnapshotColumn;
+
+/**
+ * @brief 스냅샷에 쓸 열 정보
+ */
+typedef struct {
+    const char *name;              /**< 열 이름 */
+    size_t name_length;
+    uint32_t type;                 /**< CSV_SNAPSHOT_STRING / INT64 / DOUBLE */
+    const void *values;            /**< 숫자 열의 값 배열 (row_count개), 문자열 열은 NULL */
+} CSVSnapshotSource;
+
+/**
+ * @brief 셀 값을 돌려주는 콜백
+ * @param user csv_snapshot_write()에 전달한 사용자 데이터
+ * @param row 행 인덱스
+ * @param col 열 인덱스
+ * @param length 셀 길이를 저장할 포인터
+ * @return 셀 시작 (NUL 종료가 아니어도 됨)
+ */
+typedef const char* (*CSVSnapshotCellFn)(void *user, size_t row, size_t col, size_t *length);
+
+/**
+ * @brief 체크섬을 계산합니다 (8바이트 단위 FNV-1a 변형)
+ * @param data 데이터
+ * @param len 길이
+ * @return 64비트 체크섬
+ */
+uint64_t csv_snapshot_checksum(const void *data, size_t len);
+
+/**
+ * @brief 테이블을 스냅샷 파일로 저장합니다
+ * @param filename 저장할 파일 경로
+ * @param row_count 행 개수
+ * @param col_count 열 개수
+ * @param columns 열 정보 (col_count개)
+ * @param cell 셀 값 콜백
+ * @param user 콜백에 그대로 전달할 사용자 데이터
+ * @return 성공 시 0, 실패 시 -1
+ */
+int csv_snapshot_write(const char *filename, size_t row_count, size_t col_count,
+                       const CSVSnapshotSource *columns, CSVSnapshotCellFn cell, void *user);
+
+/**
+ * @brief 매핑된 스냅샷의 형식과 범위를 검사합니다
+ * @param data 파일 내용
+ * @param size 파일 크기
+ * @param verify_payload 0이 아니면 본문 체크섬까지 검사 (파일 전체를 읽음)
+ * @return 올바르면 0, 아니면 -1
+ *
+ * @note 머리와 열 목록의 체크섬, 모든 배열의 범위와 정렬은 항상 검사합니다 (열 수에 비례).
+ *       본문 체크섬을 건너뛰면 셀 내용이 손상되어도 알아채지 못합니다
+ */
+int csv_snapshot_validate(const void *data, size_t size, int verify_payload);
+
+/**
+ * @brief 파일을 읽기 전용(copy-on-write)으로 메모리에 매핑합니다
+ * @param filename 파일 경로
+ * @param size 파일 크기를 저장할 포인터
+ * @return 매핑 시작, 실패하거나 빈 파일이면 NULL
+ */
+void* csv_snapshot_map(const char *filename, size_t *size);
+
+/**
+ * @brief csv_snapshot_map()으로 만든 매핑을 해제합니다
+ * @param data 매핑 시작 (NULL 가능)
+ * @param size 매핑 크기
+ */
+void csv_snapshot_unmap(void *data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_SNAPSHOT_H */
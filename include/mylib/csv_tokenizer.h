@@ -0,0 +1,142 @@
+#ifndef CSV_TOKENIZER_H
+#define CSV_TOKENIZER_H
+
+#include <stddef.h>  /* size_t */
+#include "mylib/csv_scan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 토큰화된 필드 (원본 버퍼를 가리키는 구간)
+ *
+ * 필드 내용은 복사하지 않습니다. quoted가 0이면 [data, data + length)가
+ * 곧 필드 값이고, 1이면 csv_field_decode()로 따옴표를 풀어야 합니다.
+ */
+typedef struct {
+    const char *data;    /**< 원본 버퍼 내 필드 시작 위치 */
+    size_t length;       /**< 원본 바이트 수 */
+    int quoted;          /**< 따옴표를 포함하는지 여부 */
+} CSVField;
+
+/**
+ * @brief 한 레코드(행)의 필드 목록
+ *
+ * 여러 레코드를 읽는 동안 같은 배열을 재사용하므로 행마다 할당하지 않습니다.
+ */
+typedef struct {
+    CSVField *fields;    /**< 필드 배열 */
+    size_t count;        /**< 현재 레코드의 필드 개수 */
+    size_t capacity;     /**< 할당된 필드 배열 용량 */
+} CSVRecord;
+
+/**
+ * @brief 메모리 버퍼를 레코드 단위로 나누는 토크나이저
+ *
+ * CSVScanner로 특수 문자 위치만 건너뛰며 읽고, 특수 문자마다 RFC 4180 상태 기계의
+ * 전이 표(문자 부류 × 상태)로 필드/레코드 끝을 정합니다. 따옴표 안의 `,`와 줄바꿈,
+ * `""`(따옴표 한 글자)는 필드에 남습니다.
+ * "\n", "\r", "\r\n" 모두 줄 끝으로 인식하고 빈 줄은 건너뜁니다.
+ */
+typedef struct {
+    CSVScanner scanner;  /**< 특수 문자 스캐너 */
+    size_t pos;          /**< 다음 레코드의 시작 오프셋 (= 소비한 바이트 수) */
+    int at_eof;          /**< 버퍼의 끝이 입력의 끝인지 여부 */
+} CSVTokenizer;
+
+/**
+ * @brief 레코드를 빈 상태로 초기화합니다
+ * @param rec 레코드
+ */
+void csv_record_init(CSVRecord *rec);
+
+/**
+ * @brief 레코드의 필드 배열을 해제합니다
+ * @param rec 레코드
+ */
+void csv_record_free(CSVRecord *rec);
+
+/**
+ * @brief 토크나이저를 초기화합니다
+ * @param tok 토크나이저
+ * @param data 입력 버퍼
+ * @param len 입력 길이
+ * @param at_eof 버퍼 끝이 입력의 끝이면 1, 뒤에 데이터가 더 올 수 있으면 0
+ */
+void csv_tokenizer_init(CSVTokenizer *tok, const char *data, size_t len, int at_eof);
+
+/**
+ * @brief 다음 레코드를 읽습니다
+ * @param tok 토크나이저
+ * @param rec 필드를 채울 레코드
+ * @return 1: 레코드를 읽음, 0: 더 읽을 레코드가 없음, -1: 메모리 할당 실패
+ *
+ * @note at_eof가 0이면 버퍼 끝에서 끊긴 레코드는 읽지 않고 0을 반환합니다.
+ *       이때 tok->pos부터 남은 바이트를 다음 버퍼 앞에 이어 붙이면 됩니다.
+ */
+int csv_tokenizer_next(CSVTokenizer *tok, CSVRecord *rec);
+
+/**
+ * @brief 필드 값을 복원하여 out에 씁니다 (RFC 4180)
+ * @param field 필드
+ * @param out 출력 버퍼 (최소 field->length 바이트)
+ * @return 복원된 바이트 수 (NUL 종료하지 않음)
+ *
+ * @note 감싸는 따옴표는 빼고, 따옴표 안의 `""`는 `"` 하나로 씁니다.
+ *       닫는 따옴표 뒤의 글자는 그대로 이어 붙입니다 (`"a"b` → `ab`).
+ * @note out이 field->data와 같아도 됩니다 (제자리 복원)
+ */
+size_t csv_field_decode(const CSVField *field, char *out);
+
+/**
+ * @brief 값을 CSV 필드로 쓸 때 따옴표로 감싸야 하는지 확인합니다
+ * @param value 값
+ * @param length 값 길이
+ * @return `,` `"` 줄바꿈이 있거나 앞뒤가 공백이면 1, 아니면 0
+ */
+int csv_field_needs_quotes(const char *value, size_t length);
+
+/**
+ * @brief 값을 CSV 필드로 인코딩하여 out에 씁니다 (RFC 4180)
+ * @param value 값
+ * @param length 값 길이
+ * @param out 출력 버퍼 (최소 CSV_FIELD_ENCODED_MAX(length) 바이트)
+ * @return 쓴 바이트 수
+ *
+ * @note 따옴표가 필요 없으면 그대로 복사하고, 필요하면 전체를 "로 감싸고 안의 "는 ""로 씁니다
+ */
+size_t csv_field_encode(const char *value, size_t length, char *out);
+
+/** @brief csv_field_encode()가 쓸 수 있는 최대 바이트 수 */
+#define CSV_FIELD_ENCODED_MAX(length) (2 * (length) + 2)
+
+/**
+ * @brief [begin, end) 구간을 n개의 균등한 바이트 구간으로 나눕니다
+ * @param begin 시작 오프셋
+ * @param end 끝 오프셋
+ * @param n 구간 개수 (1 이상)
+ * @param bounds 경계를 받을 배열 (n + 1개). bounds[0] = begin, bounds[n] = end
+ *
+ * @note 멀티스레드 파싱 1단계: 이후 각 구간의 따옴표를 세고 csv_chunk_align()을 호출합니다
+ */
+void csv_chunk_plan(size_t begin, size_t end, size_t n, size_t *bounds);
+
+/**
+ * @brief 균등 분할 경계를 따옴표를 고려한 레코드 시작 위치로 옮깁니다
+ * @param data 전체 버퍼 (길이는 bounds[n])
+ * @param n 구간 개수
+ * @param quote_counts csv_chunk_plan()이 만든 각 구간의 따옴표 개수 (n개)
+ * @param bounds 조정할 경계 배열 (n + 1개)
+ *
+ * @note 따옴표 개수의 홀짝을 누적하여 경계가 따옴표 필드 안에 있는지 판단하므로
+ *       여러 줄에 걸친 따옴표 필드를 잘못 자르지 않습니다.
+ *       레코드가 구간보다 길면 일부 구간은 비어 있을 수 있습니다.
+ */
+void csv_chunk_align(const char *data, size_t n, const size_t *quote_counts, size_t *bounds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_TOKENIZER_H */
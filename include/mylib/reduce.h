@@ -0,0 +1,76 @@
+#ifndef REDUCE_H
+#define REDUCE_H
+
+#include <stddef.h>  /* size_t */
+#include <stdint.h>  /* int64_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 숫자 배열 리덕션 커널
+ *
+ * 합계/최솟값/최댓값/개수를 배열을 한 번만 훑으며 함께 구합니다.
+ * SIMD(SSE2 기본, 가능하면 AVX2를 런타임에 선택)로 여러 누산기를 나란히 씁니다.
+ *
+ * @note average(), Calculator::average(), CSVTable::aggregate()가 공유합니다
+ */
+
+/**
+ * @brief 정수 배열 리덕션 결과
+ */
+typedef struct {
+    int64_t sum;     /**< 합계 (int64 범위를 넘으면 순환) */
+    int64_t min;     /**< 최솟값 (count가 0이면 INT64_MAX) */
+    int64_t max;     /**< 최댓값 (count가 0이면 INT64_MIN) */
+    size_t count;    /**< 원소 개수 */
+} ReduceInt64;
+
+/**
+ * @brief 실수 배열 리덕션 결과
+ */
+typedef struct {
+    double sum;      /**< 합계 (NaN이 있으면 NaN) */
+    double min;      /**< 최솟값, NaN은 건너뜀 (모두 NaN이거나 count가 0이면 +inf) */
+    double max;      /**< 최댓값, NaN은 건너뜀 (모두 NaN이거나 count가 0이면 -inf) */
+    size_t count;    /**< 원소 개수 */
+} ReduceDouble;
+
+/**
+ * @brief int 배열의 합계를 구합니다 (64비트로 누적하여 오버플로우 방지)
+ * @param values 배열 (count가 0이면 NULL 가능)
+ * @param count 원소 개수
+ * @return 합계
+ */
+long long reduce_sum_int(const int *values, size_t count);
+
+/**
+ * @brief int64 배열의 합계/최솟값/최댓값을 한 번에 구합니다
+ * @param values 배열 (count가 0이면 NULL 가능)
+ * @param count 원소 개수
+ * @param out 결과를 저장할 포인터
+ */
+void reduce_int64(const int64_t *values, size_t count, ReduceInt64 *out);
+
+/**
+ * @brief double 배열의 합계/최솟값/최댓값을 한 번에 구합니다
+ * @param values 배열 (count가 0이면 NULL 가능)
+ * @param count 원소 개수
+ * @param out 결과를 저장할 포인터
+ *
+ * @note 누산기를 나누어 더하므로 합계는 앞에서부터 더한 값과 반올림 오차만큼 다를 수 있습니다
+ */
+void reduce_double(const double *values, size_t count, ReduceDouble *out);
+
+/**
+ * @brief 선택된 리덕션 구현 이름을 반환합니다
+ * @return "avx2", "sse2", "scalar" 중 하나
+ */
+const char* reduce_backend(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REDUCE_H */
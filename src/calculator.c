@@ -1,4 +1,5 @@
 #include "mylib/calculator.h"
+#include "mylib/reduce.h"
 #include <stddef.h>  /* size_t */
 
 /* 왜 이렇게?: 간단한 함수는 인라인으로 최적화 가능성 */
@@ -36,11 +37,8 @@ double average(const int *arr, size_t size) {
         return 0.0;
     }
 
-    long long sum = 0;  /* 오버플로우 방지용 큰 타입 */
-
-    for (size_t i = 0; i < size; i++) {
-        sum += arr[i];
-    }
+    /* 64비트로 누적하는 SIMD 커널 (오버플로우 방지, CSV 집계와 공유) */
+    long long sum = reduce_sum_int(arr, size);
 
     return (double)sum / size;  /* 명시적 캐스팅 */
 }
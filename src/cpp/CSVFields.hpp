@@ -0,0 +1,118 @@
+#ifndef CSV_FIELDS_HPP
+#define CSV_FIELDS_HPP
+
+// 내부 전용 헤더: C 토크나이저의 필드를 C++ 문자열/뷰로 바꾸는 공용 함수
+
+#include "mylib/csv_tokenizer.h"
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mylib {
+namespace detail {
+
+constexpr const char* kWhitespace = " \t\r\n";
+
+// 셀 앞뒤의 공백 문자를 제거한 뷰를 반환합니다
+inline std::string_view trim(std::string_view cell) {
+    size_t first = cell.find_first_not_of(kWhitespace);
+    if (first == std::string_view::npos) {
+        return std::string_view();
+    }
+    size_t last = cell.find_last_not_of(kWhitespace);
+    return cell.substr(first, last - first + 1);
+}
+
+// 토크나이저가 쓰는 필드 배열을 RAII로 관리합니다
+struct RecordBuffer {
+    CSVRecord record;
+
+    RecordBuffer() { csv_record_init(&record); }
+    ~RecordBuffer() { csv_record_free(&record); }
+
+    RecordBuffer(const RecordBuffer&) = delete;
+    RecordBuffer& operator=(const RecordBuffer&) = delete;
+};
+
+// 필드를 복원하여 새 문자열로 만듭니다 (따옴표가 없는 필드는 앞뒤 공백 제거)
+inline std::string decodeField(const CSVField& field) {
+    if (!field.quoted) {
+        return std::string(trim(std::string_view(field.data, field.length)));
+    }
+    std::string value(field.length, '\0');
+    value.resize(csv_field_decode(&field, &value[0]));
+    return value;
+}
+
+// 필드를 복원한 뷰를 반환합니다 (따옴표 필드는 scratch에 풀고, 나머지는 원본을 가리킴)
+inline std::string_view decodeField(const CSVField& field, std::string& scratch) {
+    if (!field.quoted) {
+        return trim(std::string_view(field.data, field.length));
+    }
+    scratch.resize(field.length);
+    scratch.resize(csv_field_decode(&field, &scratch[0]));
+    return scratch;
+}
+
+// 필드를 원래 자리에서 복원합니다 (수정 가능한 버퍼 위의 필드에만 호출)
+inline std::string_view decodeFieldInPlace(const CSVField& field) {
+    if (!field.quoted) {
+        return trim(std::string_view(field.data, field.length));
+    }
+    char* out = const_cast<char*>(field.data);
+    return std::string_view(out, csv_field_decode(&field, out));
+}
+
+// 요청한 열 이름을 헤더 인덱스로 바꿉니다 (빈 목록이면 빈 결과 = 전체 열)
+inline std::vector<size_t> resolveColumns(const std::vector<std::string>& headers,
+                                          const std::vector<std::string>& names) {
+    std::vector<size_t> indices;
+    indices.reserve(names.size());
+    for (const auto& name : names) {
+        auto it = std::find(headers.begin(), headers.end(), name);
+        if (it == headers.end()) {
+            throw std::runtime_error("Header not found: " + name);
+        }
+        indices.push_back(static_cast<size_t>(it - headers.begin()));
+    }
+    return indices;
+}
+
+// 인덱스 목록에 해당하는 헤더만 골라냅니다
+inline std::vector<std::string> projectHeaders(const std::vector<std::string>& headers,
+                                               const std::vector<size_t>& indices) {
+    if (indices.empty()) {
+        return headers;
+    }
+    std::vector<std::string> projected;
+    projected.reserve(indices.size());
+    for (size_t index : indices) {
+        projected.push_back(headers[index]);
+    }
+    return projected;
+}
+
+// [begin, end)의 첫 레코드를 헤더로 읽고 begin을 다음 레코드 시작으로 옮깁니다 (레코드가 없으면 빈 벡터)
+inline std::vector<std::string> readHeader(const char* text, size_t& begin, size_t end) {
+    CSVTokenizer tokenizer;
+    csv_tokenizer_init(&tokenizer, text + begin, end - begin, 1);
+    RecordBuffer buffer;
+    int status = csv_tokenizer_next(&tokenizer, &buffer.record);
+    if (status < 0) {
+        throw std::bad_alloc();
+    }
+    std::vector<std::string> headers;
+    for (size_t i = 0; status == 1 && i < buffer.record.count; ++i) {
+        headers.push_back(decodeField(buffer.record.fields[i]));
+    }
+    begin += tokenizer.pos;
+    return headers;
+}
+
+} // namespace detail
+} // namespace mylib
+
+#endif // CSV_FIELDS_HPP
@@ -0,0 +1,60 @@
+#include "cpp/mylib/CSVFilter.hpp"
+#include "cpp/mylib/CSVNumber.hpp"
+
+namespace mylib {
+
+namespace {
+
+template <typename T>
+bool compare(const T& lhs, CompareOp op, const T& rhs) {
+    switch (op) {
+        case CompareOp::Equal:
+            return lhs == rhs;
+        case CompareOp::NotEqual:
+            return lhs != rhs;
+        case CompareOp::Less:
+            return lhs < rhs;
+        case CompareOp::LessEqual:
+            return lhs <= rhs;
+        case CompareOp::Greater:
+            return lhs > rhs;
+        case CompareOp::GreaterEqual:
+            return lhs >= rhs;
+    }
+    return false;
+}
+
+} // namespace
+
+CSVPredicate::CSVPredicate(std::string column, CompareOp op, std::string value)
+    : column_(std::move(column))
+    , op_(op)
+    , text_(std::move(value))
+    , number_(0.0)
+    , numeric_(false) {
+}
+
+CSVPredicate::CSVPredicate(std::string column, CompareOp op, double value)
+    : column_(std::move(column))
+    , op_(op)
+    , number_(value)
+    , numeric_(true) {
+}
+
+bool CSVPredicate::matches(std::string_view cell) const {
+    if (!numeric_) {
+        return compare(cell, op_, std::string_view(text_));
+    }
+
+    double value;
+    if (!parseDouble(cell, value)) {
+        return false;  // 숫자가 아닌 셀은 어떤 숫자 조건도 만족하지 않음
+    }
+    return compare(value, op_, number_);
+}
+
+const std::string& CSVPredicate::column() const {
+    return column_;
+}
+
+} // namespace mylib
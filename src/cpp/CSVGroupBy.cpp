@@ -0,0 +1,402 @@
+#include "cpp/mylib/CSVTable.hpp"
+#include "cpp/mylib/ThreadPool.hpp"
+#include "CSVGroupBy.hpp"
+#include "CSVHash.hpp"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+namespace mylib {
+
+namespace {
+
+using detail::hashBytes;
+using detail::mix;
+
+// 스레드 하나가 맡을 최소 행 수 (이보다 작은 테이블은 나누지 않음)
+constexpr size_t kMinRowsPerThread = 64 * 1024;
+
+// 키 해시를 미리 구해 두는 행 묶음 크기 (해시 계산과 탐사를 나눠 각 루프를 단순하게)
+constexpr size_t kHashBatch = 1024;
+
+constexpr uint32_t kEmptySlot = std::numeric_limits<uint32_t>::max();
+
+// 사전 열 키 하나로 묶을 때 해시 테이블 없이 코드로 바로 집계할 최대 사전 크기
+// (스레드마다 사전 크기 × 집계 수만큼 누적 상태를 둠)
+constexpr size_t kMaxDirectGroups = 64 * 1024;
+
+constexpr size_t kNoRow = std::numeric_limits<size_t>::max();
+
+// 한 집계의 누적 상태 (열 타입에 맞는 필드만 사용)
+struct Accumulator {
+    uint64_t int_sum = 0;   // 순환 덧셈을 정의된 동작으로 하기 위해 부호 없이 누적
+    int64_t int_min = std::numeric_limits<int64_t>::max();
+    int64_t int_max = std::numeric_limits<int64_t>::min();
+    double sum = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    uint64_t count = 0;
+
+    void add(int64_t value) {
+        int_sum += static_cast<uint64_t>(value);
+        int_min = std::min(int_min, value);
+        int_max = std::max(int_max, value);
+        ++count;
+    }
+
+    void add(double value) {
+        sum += value;
+        min = (value < min) ? value : min;  // NaN은 건너뜀
+        max = (value > max) ? value : max;
+        ++count;
+    }
+
+    void merge(const Accumulator& other) {
+        int_sum += other.int_sum;
+        int_min = std::min(int_min, other.int_min);
+        int_max = std::max(int_max, other.int_max);
+        sum += other.sum;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        count += other.count;
+    }
+};
+
+// 집계 하나의 입력 (타입 배열을 미리 꺼내 둠)
+struct AggregateInput {
+    AggregateOp op;
+    ColumnType type;
+    const int64_t* ints = nullptr;
+    const double* doubles = nullptr;
+};
+
+/**
+ * 오픈 어드레싱(선형 탐사) 해시 테이블
+ *
+ * 슬롯에는 미리 구한 키 해시와 그룹 번호만 두고, 키 비교는 그룹의 대표 행 셀로 합니다.
+ * 해시가 같을 때만 셀을 비교하므로 대부분의 탐사는 정수 비교로 끝납니다.
+ */
+class GroupTable {
+private:
+    struct Slot {
+        uint64_t hash;
+        uint32_t group;
+    };
+
+    const CSVTable& table_;
+    const std::vector<size_t>& keys_;
+    std::vector<Slot> slots_;
+    size_t mask_;
+
+    bool sameKey(size_t a, size_t b) const {
+        for (size_t key : keys_) {
+            const CSVTable::Column& column = table_.column(key);
+            if (column.isDictionary() ? column.codes()[a] != column.codes()[b] : column[a] != column[b]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void grow() {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(old.size() * 2, Slot{0, kEmptySlot});
+        mask_ = slots_.size() - 1;
+        for (const Slot& slot : old) {
+            if (slot.group == kEmptySlot) {
+                continue;
+            }
+            size_t pos = slot.hash & mask_;
+            while (slots_[pos].group != kEmptySlot) {
+                pos = (pos + 1) & mask_;
+            }
+            slots_[pos] = slot;
+        }
+    }
+
+public:
+    std::vector<size_t> rows;       // 그룹별 대표 행 (처음 나온 행)
+    std::vector<uint64_t> hashes;   // 그룹별 키 해시
+
+    GroupTable(const CSVTable& table, const std::vector<size_t>& keys)
+        : table_(table)
+        , keys_(keys)
+        , slots_(1024, Slot{0, kEmptySlot})
+        , mask_(slots_.size() - 1) {
+    }
+
+    // row의 그룹 번호를 찾고, 없으면 새 그룹을 만듭니다
+    size_t findOrInsert(uint64_t hash, size_t row) {
+        size_t pos = hash & mask_;
+        while (slots_[pos].group != kEmptySlot) {
+            const Slot& slot = slots_[pos];
+            if (slot.hash == hash && sameKey(rows[slot.group], row)) {
+                return slot.group;
+            }
+            pos = (pos + 1) & mask_;
+        }
+
+        if (rows.size() >= kEmptySlot) {
+            throw std::length_error("Too many groups");
+        }
+        const size_t group = rows.size();
+        slots_[pos] = Slot{hash, static_cast<uint32_t>(group)};
+        rows.push_back(row);
+        hashes.push_back(hash);
+        if (rows.size() * 2 > slots_.size()) {  // 부하율 1/2 유지
+            grow();
+        }
+        return group;
+    }
+
+    size_t size() const { return rows.size(); }
+};
+
+// 행의 키 해시 (여러 키는 섞어서 하나로)
+uint64_t hashRow(const CSVTable& table, const std::vector<size_t>& keys, size_t row) {
+    uint64_t h = 0;
+    for (size_t key : keys) {
+        const CSVTable::Column& column = table.column(key);
+        const uint64_t cell = column.isDictionary() ? mix(column.codes()[row]) : hashBytes(column[row]);
+        h = mix(h + cell + 0x9e3779b97f4a7c15ULL);
+    }
+    return h;
+}
+
+// 한 행의 값을 그룹의 누적 상태들에 더합니다
+void accumulateRow(Accumulator* acc, const std::vector<AggregateInput>& inputs, size_t row) {
+    for (size_t j = 0; j < inputs.size(); ++j) {
+        const AggregateInput& input = inputs[j];
+        if (input.ints != nullptr) {
+            acc[j].add(input.ints[row]);
+        } else if (input.doubles != nullptr) {
+            acc[j].add(input.doubles[row]);
+        } else {
+            ++acc[j].count;
+        }
+    }
+}
+
+// [first, last) 행을 부분 집계합니다
+void aggregateRange(const CSVTable& table, const std::vector<size_t>& keys,
+                    const std::vector<AggregateInput>& inputs, size_t first, size_t last,
+                    GroupTable& groups, std::vector<Accumulator>& accumulators) {
+    const size_t width = inputs.size();
+    uint64_t hashes[kHashBatch];
+    for (size_t batch = first; batch < last; batch += kHashBatch) {
+        const size_t count = std::min(kHashBatch, last - batch);
+        for (size_t i = 0; i < count; ++i) {
+            hashes[i] = hashRow(table, keys, batch + i);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const size_t row = batch + i;
+            const size_t group = groups.findOrInsert(hashes[i], row);
+            if ((group + 1) * width > accumulators.size()) {
+                accumulators.resize((group + 1) * width);
+            }
+
+            accumulateRow(accumulators.data() + group * width, inputs, row);
+        }
+    }
+}
+
+// [first, last) 행을 사전 코드별로 부분 집계합니다 (코드 = 그룹 번호)
+void aggregateCodes(const uint32_t* codes, const std::vector<AggregateInput>& inputs, size_t first, size_t last,
+                    std::vector<size_t>& first_rows, std::vector<Accumulator>& accumulators) {
+    const size_t width = inputs.size();
+    for (size_t row = first; row < last; ++row) {
+        const uint32_t code = codes[row];
+        if (first_rows[code] == kNoRow) {
+            first_rows[code] = row;
+        }
+        accumulateRow(accumulators.data() + code * width, inputs, row);
+    }
+}
+
+const char* opName(AggregateOp op) {
+    switch (op) {
+        case AggregateOp::Sum:
+            return "sum";
+        case AggregateOp::Min:
+            return "min";
+        case AggregateOp::Max:
+            return "max";
+        case AggregateOp::Mean:
+            return "mean";
+        case AggregateOp::Count:
+            return "count";
+    }
+    return "?";
+}
+
+void appendResult(CSVTable::Column& out, const AggregateInput& input, const Accumulator& acc) {
+    const bool integer = input.type == ColumnType::Int64;
+    switch (input.op) {
+        case AggregateOp::Count:
+            out.appendInt(static_cast<int64_t>(acc.count));
+            break;
+        case AggregateOp::Sum:
+            integer ? out.appendInt(static_cast<int64_t>(acc.int_sum)) : out.appendDouble(acc.sum);
+            break;
+        case AggregateOp::Min:
+            integer ? out.appendInt(acc.int_min) : out.appendDouble(acc.min);
+            break;
+        case AggregateOp::Max:
+            integer ? out.appendInt(acc.int_max) : out.appendDouble(acc.max);
+            break;
+        case AggregateOp::Mean: {
+            const double sum = integer ? static_cast<double>(static_cast<int64_t>(acc.int_sum)) : acc.sum;
+            out.appendDouble(sum / static_cast<double>(acc.count));
+            break;
+        }
+    }
+}
+
+} // namespace
+
+std::string detail::aggregateName(const GroupAggregate& aggregate) {
+    return std::string(opName(aggregate.op)) + "(" + aggregate.column + ")";
+}
+
+CSVTable CSVTable::groupBy(const std::vector<std::string>& keys, const std::vector<GroupAggregate>& aggregates,
+                           size_t threads) const {
+    if (keys.empty()) {
+        throw std::invalid_argument("groupBy needs at least one key column");
+    }
+
+    std::vector<size_t> key_columns;
+    key_columns.reserve(keys.size());
+    for (const auto& key : keys) {
+        key_columns.push_back(findColumn(key));
+    }
+
+    std::vector<AggregateInput> inputs;
+    std::vector<std::string> headers(keys);
+    inputs.reserve(aggregates.size());
+    for (const auto& aggregate : aggregates) {
+        const Column& column = this->column(aggregate.column);
+        AggregateInput input{aggregate.op, column.type()};
+        if (aggregate.op != AggregateOp::Count) {
+            if (column.type() == ColumnType::Int64) {
+                input.ints = column.ints().data();
+            } else if (column.type() == ColumnType::Double) {
+                input.doubles = column.doubles().data();
+            } else {
+                throw std::runtime_error("Column is not numeric: " + aggregate.column);
+            }
+        }
+        inputs.push_back(input);
+        headers.push_back(detail::aggregateName(aggregate));
+    }
+
+    const size_t rows = rowCount();
+    if (threads == 0) {
+        threads = ThreadPool::defaultThreadCount();
+    }
+    threads = std::max<size_t>(1, std::min(threads, rows / kMinRowsPerThread));
+
+    const size_t width = inputs.size();
+    std::vector<size_t> group_rows;  // 그룹별 대표 행 (처음 나온 순서)
+    std::vector<Accumulator> values;
+    const Column& lead = columns_[key_columns[0]];
+    auto runParts = [&](const std::function<void(size_t)>& runPart) {
+        if (threads == 1) {
+            runPart(0);
+        } else {
+            ThreadPool pool(threads);
+            pool.parallelFor(threads, runPart);
+        }
+    };
+
+    if (key_columns.size() == 1 && lead.isDictionary() && lead.dictionarySize() <= kMaxDirectGroups) {
+        // 사전 열 하나: 코드가 곧 그룹 번호이므로 해시와 키 비교가 필요 없음
+        const size_t codes = lead.dictionarySize();
+        std::vector<std::vector<size_t>> partial_rows(threads, std::vector<size_t>(codes, kNoRow));
+        std::vector<std::vector<Accumulator>> partial_values(threads, std::vector<Accumulator>(codes * width));
+        runParts([&](size_t t) {
+            const size_t first = rows * t / threads;
+            const size_t last = rows * (t + 1) / threads;
+            aggregateCodes(lead.codes().data(), inputs, first, last, partial_rows[t], partial_values[t]);
+        });
+
+        // 구간 순서대로 합치면 코드별 첫 행은 처음으로 값을 본 구간의 것
+        std::vector<size_t> first_rows(codes, kNoRow);
+        std::vector<Accumulator> by_code(codes * width);
+        for (size_t t = 0; t < threads; ++t) {
+            for (size_t code = 0; code < codes; ++code) {
+                if (partial_rows[t][code] == kNoRow) {
+                    continue;
+                }
+                first_rows[code] = std::min(first_rows[code], partial_rows[t][code]);
+                for (size_t i = 0; i < width; ++i) {
+                    by_code[code * width + i].merge(partial_values[t][code * width + i]);
+                }
+            }
+        }
+
+        std::vector<uint32_t> order;
+        for (size_t code = 0; code < codes; ++code) {
+            if (first_rows[code] != kNoRow) {
+                order.push_back(static_cast<uint32_t>(code));
+            }
+        }
+        std::sort(order.begin(), order.end(),
+                  [&](uint32_t a, uint32_t b) { return first_rows[a] < first_rows[b]; });
+        for (uint32_t code : order) {
+            group_rows.push_back(first_rows[code]);
+            values.insert(values.end(), by_code.begin() + code * width, by_code.begin() + (code + 1) * width);
+        }
+    } else {
+        // 1단계: 스레드마다 맡은 행 구간을 자기 해시 테이블에 부분 집계 (공유 상태 없음)
+        std::vector<GroupTable> partials;
+        std::vector<std::vector<Accumulator>> partial_values(threads);
+        partials.reserve(threads);
+        for (size_t t = 0; t < threads; ++t) {
+            partials.emplace_back(*this, key_columns);
+        }
+        runParts([&](size_t t) {
+            const size_t first = rows * t / threads;
+            const size_t last = rows * (t + 1) / threads;
+            aggregateRange(*this, key_columns, inputs, first, last, partials[t], partial_values[t]);
+        });
+
+        // 2단계: 부분 결과를 구간 순서대로 합침 (그룹 순서 = 처음 나온 순서)
+        GroupTable merged(*this, key_columns);
+        for (size_t t = 0; t < threads; ++t) {
+            const GroupTable& part = partials[t];
+            for (size_t group = 0; group < part.size(); ++group) {
+                const size_t target = merged.findOrInsert(part.hashes[group], part.rows[group]);
+                if ((target + 1) * width > values.size()) {
+                    values.resize((target + 1) * width);
+                }
+                for (size_t i = 0; i < width; ++i) {
+                    values[target * width + i].merge(partial_values[t][group * width + i]);
+                }
+            }
+        }
+        group_rows = std::move(merged.rows);
+    }
+
+    std::vector<Column> out(headers.size());
+    for (size_t group = 0; group < group_rows.size(); ++group) {
+        const size_t row = group_rows[group];
+        for (size_t k = 0; k < key_columns.size(); ++k) {
+            const Column& key = columns_[key_columns[k]];
+            if (key.type() == ColumnType::Int64) {
+                out[k].appendInt(key.ints()[row]);
+            } else if (key.type() == ColumnType::Double) {
+                out[k].appendDouble(key.doubles()[row]);
+            } else {
+                out[k].append(key[row]);
+            }
+        }
+        for (size_t i = 0; i < width; ++i) {
+            appendResult(out[key_columns.size() + i], inputs[i], values[group * width + i]);
+        }
+    }
+    return CSVTable(std::move(headers), std::move(out));
+}
+
+} // namespace mylib
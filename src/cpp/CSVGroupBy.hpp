@@ -0,0 +1,18 @@
+#ifndef CSV_GROUP_BY_HPP
+#define CSV_GROUP_BY_HPP
+
+// 내부 전용 헤더: groupBy()와 groupByFile()이 함께 쓰는 결과 열 이름
+
+#include "cpp/mylib/CSVTable.hpp"
+#include <string>
+
+namespace mylib {
+namespace detail {
+
+// 집계 결과 열 이름 ("mean(score)" 형식)
+std::string aggregateName(const GroupAggregate& aggregate);
+
+} // namespace detail
+} // namespace mylib
+
+#endif // CSV_GROUP_BY_HPP
@@ -0,0 +1,41 @@
+#ifndef CSV_HASH_HPP
+#define CSV_HASH_HPP
+
+// 내부 전용 헤더: groupBy()와 join()이 함께 쓰는 키 해시 함수
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace mylib {
+namespace detail {
+
+inline uint64_t mix(uint64_t h) {
+    // splitmix64 마무리: 하위 비트까지 고르게 섞어 2의 거듭제곱 테이블에 바로 씀
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+inline uint64_t hashBytes(std::string_view bytes) {
+    uint64_t h = 0xcbf29ce484222325ULL ^ bytes.size();
+    size_t i = 0;
+    for (; i + 8 <= bytes.size(); i += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes.data() + i, 8);
+        h = (h ^ word) * 0x100000001b3ULL;
+    }
+    uint64_t tail = 0;
+    if (i < bytes.size()) {
+        std::memcpy(&tail, bytes.data() + i, bytes.size() - i);
+    }
+    return mix(h ^ tail);
+}
+
+} // namespace detail
+} // namespace mylib
+
+#endif // CSV_HASH_HPP
@@ -0,0 +1,330 @@
+#include "cpp/mylib/CSVTable.hpp"
+#include "cpp/mylib/ThreadPool.hpp"
+#include "CSVHash.hpp"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace mylib {
+
+namespace {
+
+using detail::hashBytes;
+using detail::mix;
+
+// 스레드 하나가 탐사할 최소 행 수 (이보다 작은 테이블은 나누지 않음)
+constexpr size_t kMinRowsPerThread = 64 * 1024;
+
+// 버킷을 미리 읽어 두는 탐사 묶음 크기 (캐시 미스를 이만큼 겹침)
+constexpr size_t kProbeBatch = 64;
+
+constexpr uint32_t kNoRow = CSVTable::kMissingRow;
+
+/**
+ * 조인 키 열 하나 (해시와 비교 방식을 미리 정해 둠)
+ *
+ * 양쪽 모두 Int64 열이면 정수로, 아니면 셀 텍스트로 해시하고 비교합니다.
+ * 사전 열은 사전 항목마다 한 번만 해시해 두고 행은 코드로 찾습니다.
+ */
+class JoinKey {
+private:
+    const CSVTable::Column& column_;
+    const int64_t* ints_;
+    std::vector<uint64_t> entry_hashes_;
+
+public:
+    JoinKey(const CSVTable::Column& column, bool as_ints)
+        : column_(column)
+        , ints_(as_ints ? column.ints().data() : nullptr) {
+        if (ints_ == nullptr && column.isDictionary()) {
+            entry_hashes_.resize(column.dictionarySize());
+            for (size_t code = 0; code < entry_hashes_.size(); ++code) {
+                entry_hashes_[code] = hashBytes(column.dictionaryValue(static_cast<uint32_t>(code)));
+            }
+        }
+    }
+
+    uint64_t hash(size_t row) const {
+        if (ints_ != nullptr) {
+            return mix(static_cast<uint64_t>(ints_[row]));
+        }
+        if (!entry_hashes_.empty()) {
+            return entry_hashes_[column_.codes()[row]];
+        }
+        return hashBytes(column_[row]);
+    }
+
+    bool equals(size_t row, const JoinKey& other, size_t other_row) const {
+        if (ints_ != nullptr) {
+            return ints_[row] == other.ints_[other_row];
+        }
+        return column_[row] == other.column_[other_row];
+    }
+};
+
+// 메모리에서 미리 읽어 오도록 힌트를 줍니다 (지원하지 않는 컴파일러는 무시)
+inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+/**
+ * 작은 쪽 키로 만든 체인 해시 테이블
+ *
+ * 버킷마다 첫 행, 행마다 (키 해시, 같은 버킷의 다음 행)을 두어 (행당 약 20바이트)
+ * 한 키에 맞는 행들을 원래 행 순서대로 따라갑니다.
+ * 탐사는 묶음 단위로 버킷과 첫 항목을 미리 읽어 캐시 미스를 겹칩니다.
+ */
+class JoinTable {
+private:
+    struct Entry {
+        uint64_t hash;
+        uint32_t next;
+    };
+
+    const JoinKey& key_;
+    std::vector<Entry> entries_;
+    std::vector<uint32_t> heads_;
+    size_t mask_;
+
+public:
+    JoinTable(const JoinKey& key, const std::vector<uint64_t>& hashes)
+        : key_(key)
+        , entries_(hashes.size()) {
+        size_t buckets = 16;
+        while (buckets < hashes.size() * 2) {
+            buckets *= 2;
+        }
+        heads_.assign(buckets, kNoRow);
+        mask_ = buckets - 1;
+
+        // 뒤에서부터 넣어 체인이 행 순서가 되게 함
+        for (size_t row = hashes.size(); row-- > 0;) {
+            uint32_t& head = heads_[hashes[row] & mask_];
+            entries_[row] = Entry{hashes[row], head};
+            head = static_cast<uint32_t>(row);
+        }
+    }
+
+    void prefetchBucket(uint64_t hash) const { prefetch(&heads_[hash & mask_]); }
+
+    // 버킷의 첫 행을 읽고 그 항목을 미리 읽어 둡니다
+    uint32_t head(uint64_t hash) const {
+        const uint32_t row = heads_[hash & mask_];
+        if (row != kNoRow) {
+            prefetch(&entries_[row]);
+        }
+        return row;
+    }
+
+    // head()부터 체인을 따라 probe 쪽 행에 맞는 행마다 visit(행)을 부르고, 하나라도 맞았는지 반환합니다
+    template <typename Visit>
+    bool forEachMatch(uint32_t head, uint64_t hash, const JoinKey& probe, size_t probe_row, Visit&& visit) const {
+        bool matched = false;
+        for (uint32_t row = head; row != kNoRow; row = entries_[row].next) {
+            if (entries_[row].hash == hash && key_.equals(row, probe, probe_row)) {
+                visit(row);
+                matched = true;
+            }
+        }
+        return matched;
+    }
+};
+
+// 결과에 넣을 열 인덱스 (names가 비어 있으면 skip을 뺀 전체)
+std::vector<size_t> projectColumns(const CSVTable& table, const std::vector<std::string>& names,
+                                   size_t skip) {
+    std::vector<size_t> columns;
+    if (names.empty()) {
+        for (size_t col = 0; col < table.colCount(); ++col) {
+            if (col != skip) {
+                columns.push_back(col);
+            }
+        }
+        return columns;
+    }
+    columns.reserve(names.size());
+    for (const auto& name : names) {
+        columns.push_back(table.findColumn(name));
+    }
+    return columns;
+}
+
+} // namespace
+
+CSVTable CSVTable::join(const CSVTable& right, const std::string& left_key, const std::string& right_key,
+                        const JoinOptions& options) const {
+    const Column& left_column = column(left_key);
+    const Column& right_column = right.column(right_key);
+    const std::vector<size_t> left_out = projectColumns(*this, options.left_columns, colCount());
+    const std::vector<size_t> right_out = projectColumns(right, options.right_columns, right.findColumn(right_key));
+
+    const size_t left_rows = rowCount();
+    const size_t right_rows = right.rowCount();
+    if (left_rows >= kNoRow || right_rows >= kNoRow) {
+        throw std::length_error("Too many rows to join");
+    }
+
+    const bool as_ints = left_column.type() == ColumnType::Int64 && right_column.type() == ColumnType::Int64;
+    const JoinKey left_hashed(left_column, as_ints);
+    const JoinKey right_hashed(right_column, as_ints);
+
+    // 작은 쪽을 해시하고 큰 쪽으로 탐사 (같으면 오른쪽을 해시해 결과가 왼쪽 행 순서)
+    const bool build_left = left_rows < right_rows;
+    const size_t build_rows = build_left ? left_rows : right_rows;
+    const size_t probe_rows = build_left ? right_rows : left_rows;
+    const JoinKey& build_key = build_left ? left_hashed : right_hashed;
+    const JoinKey& probe_key = build_left ? right_hashed : left_hashed;
+
+    size_t threads = (options.threads == 0) ? ThreadPool::defaultThreadCount() : options.threads;
+    threads = std::max<size_t>(1, std::min(threads, std::max(build_rows, probe_rows) / kMinRowsPerThread));
+    std::unique_ptr<ThreadPool> pool;
+    if (threads > 1) {
+        pool = std::make_unique<ThreadPool>(threads);
+    }
+    // [0, rows)를 구간으로 나누어 run(first, last)를 병렬로 부름
+    auto forRanges = [&](size_t rows, const std::function<void(size_t, size_t)>& run) {
+        const size_t parts = std::max<size_t>(1, std::min(threads, rows / kMinRowsPerThread));
+        if (parts == 1) {
+            run(0, rows);
+            return;
+        }
+        pool->parallelFor(parts, [&](size_t part) {
+            run(rows * part / parts, rows * (part + 1) / parts);
+        });
+    };
+
+    std::vector<uint64_t> build_hashes(build_rows);
+    forRanges(build_rows, [&](size_t first, size_t last) {
+        for (size_t row = first; row < last; ++row) {
+            build_hashes[row] = build_key.hash(row);
+        }
+    });
+    const JoinTable table(build_key, build_hashes);
+    std::vector<uint64_t>().swap(build_hashes);
+
+    // 구간별로 (왼쪽 행, 오른쪽 행) 쌍을 모은 뒤 구간 순서대로 이어 붙임
+    const bool keep_left = options.type == JoinType::Left;
+    const size_t parts = std::max<size_t>(1, std::min(threads, probe_rows / kMinRowsPerThread));
+    std::vector<std::vector<uint32_t>> part_left(parts);
+    std::vector<std::vector<uint32_t>> part_right(parts);
+    std::unique_ptr<std::atomic<bool>[]> left_matched;
+    if (keep_left && build_left) {
+        left_matched.reset(new std::atomic<bool>[left_rows]());
+    }
+    auto probePart = [&](size_t part) {
+        std::vector<uint32_t>& lefts = part_left[part];
+        std::vector<uint32_t>& rights = part_right[part];
+        const size_t first = probe_rows * part / parts;
+        const size_t last = probe_rows * (part + 1) / parts;
+        uint64_t hashes[kProbeBatch];
+        uint32_t heads[kProbeBatch];
+        for (size_t batch = first; batch < last; batch += kProbeBatch) {
+            const size_t count = std::min(kProbeBatch, last - batch);
+            for (size_t i = 0; i < count; ++i) {
+                hashes[i] = probe_key.hash(batch + i);
+                table.prefetchBucket(hashes[i]);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                heads[i] = table.head(hashes[i]);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                const size_t row = batch + i;
+                const uint32_t probe = static_cast<uint32_t>(row);
+                if (build_left) {
+                    table.forEachMatch(heads[i], hashes[i], probe_key, row, [&](uint32_t match) {
+                        lefts.push_back(match);
+                        rights.push_back(probe);
+                        if (left_matched) {
+                            left_matched[match].store(true, std::memory_order_relaxed);
+                        }
+                    });
+                } else {
+                    const bool matched = table.forEachMatch(heads[i], hashes[i], probe_key, row, [&](uint32_t match) {
+                        lefts.push_back(probe);
+                        rights.push_back(match);
+                    });
+                    if (!matched && keep_left) {
+                        lefts.push_back(probe);
+                        rights.push_back(kNoRow);
+                    }
+                }
+            }
+        }
+    };
+    if (parts == 1) {
+        probePart(0);
+    } else {
+        pool->parallelFor(parts, probePart);
+    }
+
+    size_t total = 0;
+    for (const auto& lefts : part_left) {
+        total += lefts.size();
+    }
+    if (left_matched) {
+        for (size_t row = 0; row < left_rows; ++row) {
+            total += left_matched[row].load(std::memory_order_relaxed) ? 0 : 1;
+        }
+    }
+    if (total >= kNoRow) {
+        throw std::length_error("Join result too large");
+    }
+
+    std::vector<uint32_t> left_index;
+    std::vector<uint32_t> right_index;
+    left_index.reserve(total);
+    right_index.reserve(total);
+    for (size_t part = 0; part < parts; ++part) {
+        left_index.insert(left_index.end(), part_left[part].begin(), part_left[part].end());
+        right_index.insert(right_index.end(), part_right[part].begin(), part_right[part].end());
+        std::vector<uint32_t>().swap(part_left[part]);
+        std::vector<uint32_t>().swap(part_right[part]);
+    }
+    if (left_matched) {
+        for (size_t row = 0; row < left_rows; ++row) {
+            if (!left_matched[row].load(std::memory_order_relaxed)) {
+                left_index.push_back(static_cast<uint32_t>(row));
+                right_index.push_back(kNoRow);
+            }
+        }
+    }
+
+    // 결과 열만 열 단위로 병렬 복사
+    std::vector<std::string> headers;
+    headers.reserve(left_out.size() + right_out.size());
+    for (size_t col : left_out) {
+        headers.push_back(headers_[col]);
+    }
+    for (size_t col : right_out) {
+        const std::string& name = right.headers()[col];
+        const bool clash = std::any_of(left_out.begin(), left_out.end(),
+                                       [&](size_t left) { return headers_[left] == name; });
+        headers.push_back(clash ? name + options.right_suffix : name);
+    }
+
+    std::vector<Column> out(headers.size());
+    auto gatherColumn = [&](size_t i) {
+        if (i < left_out.size()) {
+            out[i] = columns_[left_out[i]].gather(left_index);
+        } else {
+            out[i] = right.column(right_out[i - left_out.size()]).gather(right_index);
+        }
+    };
+    if (threads == 1 || out.size() < 2) {
+        for (size_t i = 0; i < out.size(); ++i) {
+            gatherColumn(i);
+        }
+    } else {
+        pool->parallelFor(out.size(), gatherColumn);
+    }
+    return CSVTable(std::move(headers), std::move(out));
+}
+
+} // namespace mylib
@@ -0,0 +1,279 @@
+#include "CSVLazyRows.hpp"
+#include "CSVFields.hpp"
+#include "cpp/mylib/ThreadPool.hpp"
+#include "mylib/csv_row_index.h"
+#include "mylib/csv_scan.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace mylib {
+namespace detail {
+
+namespace {
+
+// 스레드 하나가 색인할 최소 바이트 수 (이보다 작은 파일은 나누지 않음)
+constexpr size_t kMinScanBytes = 1024 * 1024;
+
+// csv_scan_record_starts()에 한 번에 넘기는 결과 배열 크기
+constexpr size_t kStartBatch = 4096;
+
+bool isLineEnd(char c) {
+    return c == '\n' || c == '\r';
+}
+
+// [begin, end)의 레코드 시작을 out에 추가합니다 (begin 위치의 따옴표 상태는 in_quotes)
+void scanStarts(const char* text, size_t begin, size_t end, int in_quotes, std::vector<uint64_t>& out) {
+    uint64_t batch[kStartBatch];
+    size_t pos = begin;
+    while (pos < end) {
+        const size_t found = csv_scan_record_starts(text, end, &pos, &in_quotes, batch, kStartBatch);
+        out.insert(out.end(), batch, batch + found);
+    }
+}
+
+} // namespace
+
+LazyRows::LazyRows(const std::string& filename, const ParseOptions& options)
+    : mapping_(std::make_shared<const MappedFile>(filename, false, AccessPattern::Normal))
+    , options_(options)
+    , stride_(1)
+    , row_count_(0)
+    , sidecar_(false)
+    , data_begin_(0)
+    , capacity_(std::max<size_t>(1, options.lazy_cache_rows)) {
+    const char* text = mapping_->data();
+    const size_t size = mapping_->size();
+
+    const std::vector<std::string> headers = readHeader(text, data_begin_, size);
+    source_ = resolveColumns(headers, options.columns);
+    headers_ = projectHeaders(headers, source_);
+
+    if (options.use_row_index && loadIndex(filename)) {
+        return;
+    }
+    const size_t threads = (options.threads == 0) ? ThreadPool::defaultThreadCount() : options.threads;
+    buildIndex(threads);
+    row_count_ = starts_.size();
+}
+
+bool LazyRows::loadIndex(const std::string& filename) {
+    uint64_t source_size = 0;
+    uint64_t source_mtime = 0;
+    if (csv_row_index_fingerprint(filename.c_str(), &source_size, &source_mtime) != 0 ||
+        source_size != mapping_->size()) {
+        return false;
+    }
+
+    std::unique_ptr<MappedFile> index;
+    try {
+        index = std::make_unique<MappedFile>(rowIndexPath(filename));
+    } catch (const std::runtime_error&) {
+        return false;  // 색인이 없으면 스캔
+    }
+    if (csv_row_index_validate(index->data(), index->size()) != 0) {
+        return false;
+    }
+
+    // 원본이 바뀌었거나 다른 헤더로 만든 색인이면 쓰지 않음
+    const auto* header = reinterpret_cast<const CSVRowIndexHeader*>(index->data());
+    if (header->source_size != source_size || header->source_mtime != source_mtime ||
+        header->data_begin != data_begin_) {
+        return false;
+    }
+
+    const auto* offsets = reinterpret_cast<const uint64_t*>(index->data() + sizeof(CSVRowIndexHeader));
+    const size_t count = (index->size() - sizeof(CSVRowIndexHeader)) / sizeof(uint64_t);
+    starts_.assign(offsets, offsets + count);
+    stride_ = static_cast<size_t>(header->stride);
+    row_count_ = static_cast<size_t>(header->row_count);
+    sidecar_ = true;
+    return true;
+}
+
+void LazyRows::writeIndex(const std::string& filename, size_t stride, size_t threads) {
+    if (stride == 0) {
+        throw std::invalid_argument("Row index stride must be at least 1");
+    }
+    ParseOptions options;
+    options.threads = threads;
+    options.use_row_index = false;
+    const LazyRows rows(filename, options);
+
+    CSVRowIndexHeader header{};
+    uint64_t source_mtime = 0;
+    uint64_t source_size = 0;
+    if (csv_row_index_fingerprint(filename.c_str(), &source_size, &source_mtime) != 0 ||
+        source_size != rows.mapping_->size()) {
+        throw std::runtime_error("File changed while building row index: " + filename);
+    }
+    header.source_size = source_size;
+    header.source_mtime = source_mtime;
+    header.stride = stride;
+    header.row_count = rows.row_count_;
+    header.data_begin = rows.data_begin_;
+
+    std::vector<uint64_t> offsets;
+    offsets.reserve(rows.row_count_ / stride + 1);
+    for (size_t row = 0; row < rows.row_count_; row += stride) {
+        offsets.push_back(rows.starts_[row]);
+    }
+
+    const std::string path = rowIndexPath(filename);
+    if (csv_row_index_write(path.c_str(), &header, offsets.data()) != 0) {
+        throw std::runtime_error("Failed to write row index: " + path);
+    }
+}
+
+void LazyRows::buildIndex(size_t threads) {
+    const char* text = mapping_->data();
+    const size_t size = mapping_->size();
+    const size_t begin = data_begin_;
+    if (begin >= size) {
+        return;
+    }
+
+    // 헤더 바로 뒤가 빈 줄이 아니면 첫 데이터 행
+    if (!isLineEnd(text[begin])) {
+        starts_.push_back(begin);
+    }
+
+    const size_t chunk_count = std::max<size_t>(1, std::min(threads, (size - begin) / kMinScanBytes));
+    if (chunk_count == 1) {
+        scanStarts(text, begin, size, 0, starts_);
+        return;
+    }
+
+    // 1단계: 구간별 따옴표 개수로 각 구간 시작의 따옴표 상태를 구함
+    std::vector<size_t> bounds(chunk_count + 1);
+    csv_chunk_plan(begin, size, chunk_count, bounds.data());
+    std::vector<size_t> quote_counts(chunk_count);
+    ThreadPool pool(chunk_count);
+    pool.parallelFor(chunk_count, [&](size_t i) {
+        quote_counts[i] = csv_scan_count_quotes(text + bounds[i], bounds[i + 1] - bounds[i]);
+    });
+    std::vector<int> in_quotes(chunk_count, 0);
+    for (size_t i = 1; i < chunk_count; ++i) {
+        in_quotes[i] = in_quotes[i - 1] ^ static_cast<int>(quote_counts[i - 1] & 1);
+    }
+
+    // 2단계: 구간별로 병렬 색인 (구간 끝의 줄 끝 다음은 다음 구간이 맡음)
+    std::vector<std::vector<uint64_t>> parts(chunk_count);
+    pool.parallelFor(chunk_count, [&](size_t i) {
+        const size_t first = bounds[i];
+        if (i > 0 && !in_quotes[i] && isLineEnd(text[first - 1]) && !isLineEnd(text[first])) {
+            parts[i].push_back(first);
+        }
+        scanStarts(text, first, bounds[i + 1], in_quotes[i], parts[i]);
+    });
+
+    size_t total = starts_.size();
+    for (const auto& part : parts) {
+        total += part.size();
+    }
+    starts_.reserve(total);
+    for (const auto& part : parts) {
+        starts_.insert(starts_.end(), part.begin(), part.end());
+    }
+}
+
+std::pair<size_t, size_t> LazyRows::locate(size_t row) const {
+    const size_t size = mapping_->size();
+    if (stride_ == 1) {
+        const size_t end = (row + 1 < starts_.size()) ? static_cast<size_t>(starts_[row + 1]) : size;
+        return {static_cast<size_t>(starts_[row]), end};
+    }
+
+    // 색인한 행부터 skip개 레코드를 건너뛰고, 그다음 레코드 시작을 끝으로 씀
+    // (색인한 행은 레코드 시작이므로 따옴표 밖에서 시작)
+    const size_t skip = row % stride_;
+    size_t pos = static_cast<size_t>(starts_[row / stride_]);
+    size_t begin = pos;
+    size_t end = size;
+    size_t found = 0;
+    int in_quotes = 0;
+    uint64_t batch[kStartBatch];
+    while (found <= skip && pos < size) {
+        const size_t want = std::min(kStartBatch, skip + 1 - found);
+        const size_t got = csv_scan_record_starts(mapping_->data(), size, &pos, &in_quotes, batch, want);
+        for (size_t i = 0; i < got; ++i, ++found) {
+            if (found + 1 == skip) {
+                begin = static_cast<size_t>(batch[i]);
+            } else if (found == skip) {
+                end = static_cast<size_t>(batch[i]);
+            }
+        }
+    }
+    return {begin, end};
+}
+
+std::shared_ptr<const LazyRows::Row> LazyRows::tokenize(size_t row) const {
+    const char* text = mapping_->data();
+    const auto [begin, end] = locate(row);
+
+    CSVTokenizer tokenizer;
+    csv_tokenizer_init(&tokenizer, text + begin, end - begin, 1);
+    RecordBuffer buffer;
+    if (csv_tokenizer_next(&tokenizer, &buffer.record) < 0) {
+        throw std::bad_alloc();
+    }
+    const CSVRecord& record = buffer.record;
+
+    // 따옴표 셀을 풀 공간을 먼저 잡아 두어 뷰가 무효화되지 않게 함
+    auto result = std::make_shared<Row>();
+    size_t quoted_bytes = 0;
+    for (size_t col = 0; col < headers_.size(); ++col) {
+        const size_t index = source_.empty() ? col : source_[col];
+        if (index < record.count && record.fields[index].quoted) {
+            quoted_bytes += record.fields[index].length;
+        }
+    }
+    result->decoded.resize(quoted_bytes);
+
+    size_t used = 0;
+    result->cells.resize(headers_.size());
+    for (size_t col = 0; col < headers_.size(); ++col) {
+        const size_t index = source_.empty() ? col : source_[col];
+        if (index >= record.count) {
+            continue;
+        }
+        const CSVField& field = record.fields[index];
+        if (!field.quoted) {
+            result->cells[col] = trim(std::string_view(field.data, field.length));
+            continue;
+        }
+        char* out = &result->decoded[used];
+        const size_t length = csv_field_decode(&field, out);
+        result->cells[col] = std::string_view(out, length);
+        used += length;
+    }
+    return result;
+}
+
+std::shared_ptr<const LazyRows::Row> LazyRows::row(size_t index) const {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = cached_.find(index);
+        if (found != cached_.end()) {
+            lru_.splice(lru_.begin(), lru_, found->second);
+            return found->second->second;
+        }
+    }
+
+    std::shared_ptr<const Row> result = tokenize(index);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = cached_.find(index);
+    if (found != cached_.end()) {
+        return found->second->second;  // 다른 스레드가 먼저 넣음
+    }
+    lru_.emplace_front(index, result);
+    cached_[index] = lru_.begin();
+    if (lru_.size() > capacity_) {
+        cached_.erase(lru_.back().first);
+        lru_.pop_back();
+    }
+    return result;
+}
+
+} // namespace detail
+} // namespace mylib
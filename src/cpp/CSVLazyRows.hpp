@@ -0,0 +1,89 @@
+#ifndef CSV_LAZY_ROWS_HPP
+#define CSV_LAZY_ROWS_HPP
+
+// 내부 전용 헤더: ParseMode::Lazy의 행 위치 색인과 토큰화한 행 캐시
+
+#include "cpp/mylib/CSVParser.hpp"
+#include "cpp/mylib/MappedFile.hpp"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mylib {
+namespace detail {
+
+/**
+ * 매핑한 파일의 레코드 시작 위치만 색인해 두고, 행은 처음 접근할 때 토큰화합니다
+ *
+ * 파일 옆에 지문이 맞는 사이드카 색인(rowIndexPath())이 있으면 스캔하지 않고
+ * stride행마다의 오프셋만 읽어 두며, 행을 찾을 때 가까운 앞 오프셋부터 많아야
+ * stride - 1개 레코드를 건너뜁니다.
+ * 토큰화한 행은 최근에 쓴 순서로 최대 cache_rows개까지 보관합니다.
+ * 여러 스레드가 동시에 row()를 불러도 안전합니다 (토큰화는 잠금 밖에서 함).
+ */
+class LazyRows {
+public:
+    // 토큰화한 행 (따옴표가 없는 셀은 매핑을 가리키고, 따옴표 셀만 decoded에 풀어 둠)
+    struct Row {
+        std::vector<std::string_view> cells;   // 헤더 개수에 맞춤 (없는 필드는 빈 뷰)
+        std::string decoded;
+    };
+
+private:
+    std::shared_ptr<const MappedFile> mapping_;
+    ParseOptions options_;
+    std::vector<std::string> headers_;   // 프로젝션을 적용한 헤더
+    std::vector<size_t> source_;         // 열별 원본 필드 인덱스 (비어 있으면 같은 위치)
+    std::vector<uint64_t> starts_;       // stride_행마다의 데이터 레코드 시작 오프셋
+    size_t stride_;                      // 1이면 모든 행의 시작을 색인함
+    size_t row_count_;
+    bool sidecar_;                       // 사이드카 색인에서 읽었는지
+    size_t data_begin_;                  // 헤더 바로 뒤 (materialize()가 여기서부터 파싱)
+
+    size_t capacity_;
+    mutable std::mutex mutex_;
+    mutable std::list<std::pair<size_t, std::shared_ptr<const Row>>> lru_;  // 앞이 최근
+    mutable std::unordered_map<size_t, decltype(lru_)::iterator> cached_;
+
+    void buildIndex(size_t threads);
+    bool loadIndex(const std::string& filename);
+    std::pair<size_t, size_t> locate(size_t row) const;
+    std::shared_ptr<const Row> tokenize(size_t row) const;
+
+public:
+    /**
+     * 파일을 매핑하고 헤더를 읽은 뒤 레코드 시작 위치를 색인합니다
+     * (options.use_row_index이면 먼저 사이드카 색인을 찾아봄)
+     * @throws std::runtime_error 파일을 열 수 없거나 프로젝션 열이 없을 때
+     */
+    LazyRows(const std::string& filename, const ParseOptions& options);
+
+    /**
+     * 파일 전체를 스캔해 stride행마다의 오프셋을 사이드카 색인으로 저장합니다
+     * @throws std::runtime_error 파일을 읽거나 색인을 쓸 수 없을 때
+     */
+    static void writeIndex(const std::string& filename, size_t stride, size_t threads);
+
+    // 사이드카 색인 파일 경로 (원본 경로 + ".idx")
+    static std::string rowIndexPath(const std::string& filename) { return filename + ".idx"; }
+
+    // 행을 토큰화하여 반환합니다 (캐시에 있으면 그대로, 범위 검사 없음)
+    std::shared_ptr<const Row> row(size_t index) const;
+
+    size_t rowCount() const { return row_count_; }
+    bool usesSidecar() const { return sidecar_; }
+    const std::vector<std::string>& headers() const { return headers_; }
+    const ParseOptions& options() const { return options_; }
+    const MappedFile& file() const { return *mapping_; }
+    size_t dataBegin() const { return data_begin_; }
+};
+
+} // namespace detail
+} // namespace mylib
+
+#endif // CSV_LAZY_ROWS_HPP
@@ -0,0 +1,411 @@
+#include "cpp/mylib/CSVNumber.hpp"
+#include "CSVPowersOfFive.hpp"
+#include <cfloat>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <system_error>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace mylib {
+
+namespace {
+
+// 정확히 표현되는 10의 거듭제곱 (10^22까지)
+constexpr double kPowersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+constexpr int64_t kMaxExactPower = 22;
+constexpr uint64_t kMaxExactMantissa = uint64_t(1) << 53;
+constexpr size_t kMaxDigits = 19;       // 10^19 - 1 < 2^64
+constexpr uint64_t kMaxExponent = 100000;  // 이보다 큰 지수는 느린 경로에서 범위 검사
+
+// 중간 계산을 더 넓은 정밀도로 하면(x87) 반올림이 두 번 일어나므로 빠른 경로를 쓰지 않음
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+constexpr bool kExactArithmetic = true;
+#else
+constexpr bool kExactArithmetic = false;
+#endif
+
+// 셀 전체를 std::from_chars로 읽습니다 (느린 경로)
+template <typename T>
+bool parseSlow(std::string_view text, T& value) {
+    const char* first = text.data();
+    const char* last = first + text.size();
+    auto result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last;
+}
+
+// 8바이트를 첫 글자가 낮은 바이트가 되도록 읽습니다
+inline uint64_t loadEight(const char* p) {
+    uint64_t chunk;
+    std::memcpy(&chunk, p, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    chunk = __builtin_bswap64(chunk);
+#endif
+    return chunk;
+}
+
+// 8자리 숫자를 값으로 (이웃한 자리를 2자리, 4자리, 8자리로 차례로 합침)
+inline uint32_t eightDigits(uint64_t chunk) {
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+             (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return static_cast<uint32_t>(chunk);
+}
+
+// 가장 낮은 1 비트의 위치 (x는 0이 아님)
+inline unsigned countTrailingZeros(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<unsigned>(index);
+#else
+    unsigned n = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+// 가장 높은 1 비트 위의 0 개수 (x는 0이 아님)
+inline unsigned countLeadingZeros(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_clzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return 63 - static_cast<unsigned>(index);
+#else
+    unsigned n = 0;
+    while ((x & (uint64_t(1) << 63)) == 0) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+// 64비트 × 64비트 = 128비트 곱
+struct Product {
+    uint64_t high;
+    uint64_t low;
+};
+
+inline Product multiply(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+    const uint128 product = static_cast<uint128>(a) * b;
+    return {static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product)};
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64_t high;
+    const uint64_t low = _umul128(a, b, &high);
+    return {high, low};
+#else
+    const uint64_t a_low = a & 0xFFFFFFFFULL, a_high = a >> 32;
+    const uint64_t b_low = b & 0xFFFFFFFFULL, b_high = b >> 32;
+    const uint64_t low_low = a_low * b_low;
+    const uint64_t middle = (low_low >> 32) + (a_high * b_low & 0xFFFFFFFFULL) + a_low * b_high;
+    return {a_high * b_high + (a_high * b_low >> 32) + (middle >> 32), (middle << 32) | (low_low & 0xFFFFFFFFULL)};
+#endif
+}
+
+/**
+ * Eisel–Lemire: mantissa × 10^exponent를 올바르게 반올림한 double로 만듭니다
+ * @param mantissa 유효 숫자의 값 (0이 아님, 19자리 이하이므로 정확)
+ * @param exponent 10의 지수
+ * @return 반올림이 확실하면 true, 범위를 넘거나 비정규 수이거나 근사로 정할 수 없으면 false (느린 경로)
+ *
+ * 가수를 최상위 비트까지 밀고 128비트 5의 거듭제곱 근사(detail::kPowersOfFive)와 곱해
+ * 위 55비트(가수 53비트 + 반올림 비트 2개)를 얻습니다. 10^q = 5^q × 2^q이므로 2^q는 지수에 더합니다.
+ */
+inline bool eiselLemire(uint64_t mantissa, int64_t exponent, double& result) {
+    if (exponent < detail::kMinPowerOfFive || exponent > detail::kMaxPowerOfFive) {
+        return false;
+    }
+    const unsigned zeros = countLeadingZeros(mantissa);
+    const uint64_t normalized = mantissa << zeros;
+    const uint64_t* power = &detail::kPowersOfFive[2 * (exponent - detail::kMinPowerOfFive)];
+
+    // 위 64비트 곱에서 55비트 아래가 모두 1이면 올림이 번질 수 있으므로 표의 하위 64비트까지 곱함
+    constexpr uint64_t kLowMask = ~uint64_t(0) >> 55;
+    Product product = multiply(normalized, power[0]);
+    if ((product.high & kLowMask) == kLowMask) {
+        const Product low = multiply(normalized, power[1]);
+        product.low += low.high;
+        product.high += (product.low < low.high);
+    }
+    if (product.low == ~uint64_t(0) && (exponent < -27 || exponent > 55)) {
+        return false;  // 128비트 근사의 오차 안에서 반올림이 갈릴 수 있음
+    }
+
+    const unsigned upper = static_cast<unsigned>(product.high >> 63);
+    const unsigned shift = upper + 64 - 55;
+    uint64_t bits = product.high >> shift;
+    // floor(log2(10^q)) + 63 = ((217706 × q) >> 16) + 63, 여기에 double 지수 편향 1023
+    int64_t biased = ((217706 * exponent) >> 16) + 63 + upper - zeros + 1023;
+    if (biased <= 0) {
+        return false;  // 비정규 수
+    }
+    // 정확히 중간인 값은 짝수로 (중간값은 -4 <= q <= 23에서만 생길 수 있음)
+    if (product.low <= 1 && exponent >= -4 && exponent <= 23 && (bits & 3) == 1 &&
+        (bits << shift) == product.high) {
+        bits &= ~uint64_t(1);
+    }
+    bits += bits & 1;
+    bits >>= 1;
+    if (bits >= (uint64_t(2) << 52)) {
+        bits = uint64_t(1) << 52;  // 반올림으로 자리가 올라감
+        biased++;
+    }
+    if (biased >= 0x7FF) {
+        return false;  // double 범위를 넘음
+    }
+    const uint64_t word = (bits & ~(uint64_t(1) << 52)) | (static_cast<uint64_t>(biased) << 52);
+    std::memcpy(&result, &word, sizeof(result));
+    return true;
+}
+
+inline bool isDigit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+inline uint32_t loadFour(const char* p) {
+    uint32_t chunk;
+    std::memcpy(&chunk, p, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    chunk = __builtin_bswap32(chunk);
+#endif
+    return chunk;
+}
+
+// [p, end)의 앞 8바이트를 읽고 모자란 뒤쪽은 0(숫자가 아닌 바이트)으로 채웁니다
+// (짧은 셀은 memcpy처럼 겹치는 두 번의 읽기로 처리해 길이만큼 반복하지 않음, end 뒤는 읽지 않음)
+inline uint64_t loadPadded(const char* p, const char* end) {
+    const size_t n = static_cast<size_t>(end - p);
+    if (n >= 8) {
+        return loadEight(p);
+    }
+    if (n >= 4) {
+        return loadFour(p) | (static_cast<uint64_t>(loadFour(end - 4)) << (8 * (n - 4)));
+    }
+    if (n == 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(static_cast<unsigned char>(p[0])) |
+           (static_cast<uint64_t>(static_cast<unsigned char>(p[n / 2])) << (8 * (n / 2))) |
+           (static_cast<uint64_t>(static_cast<unsigned char>(p[n - 1])) << (8 * (n - 1)));
+}
+
+// 앞에서부터 이어지는 숫자 바이트 개수 (0..8)
+inline unsigned leadingDigits(uint64_t chunk) {
+    // 숫자가 아닌 바이트만 0이 아니게 됨 (뒤쪽 바이트로 번지는 올림은 첫 비숫자 뒤에서만 생김)
+    const uint64_t bad = ((chunk & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL) |
+                         (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL);
+    return (bad == 0) ? 8 : countTrailingZeros(bad) / 8;
+}
+
+// 앞 count개(1..8) 숫자 바이트의 값: 숫자들을 높은 바이트 쪽으로 밀고 빈 낮은 바이트는 '0'으로 채워 변환
+inline uint32_t leadingValue(uint64_t chunk, unsigned count) {
+    const unsigned shift = 8 * (8 - count);
+    return eightDigits((count == 8) ? chunk : (chunk << shift) | (0x3030303030303030ULL >> (64 - shift)));
+}
+
+constexpr uint64_t kPowersOfTenInt[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+/**
+ * p부터 이어지는 숫자를 value 뒤에 붙여 읽고 p를 옮깁니다
+ * @return 읽은 자리 수 (자리가 많으면 value는 넘칠 수 있으므로 호출자가 자리 수로 판단)
+ *
+ * 8바이트씩 읽어 숫자가 이어지는 길이를 구하고 그 자리들을 한 번에 변환하므로
+ * 8자리 안에서는 자리 수에 따라 분기하지 않습니다.
+ */
+inline size_t appendDigits(const char*& p, const char* end, uint64_t& value) {
+    const char* start = p;
+    for (;;) {
+        const uint64_t chunk = loadPadded(p, end);
+        const unsigned count = leadingDigits(chunk);
+        if (count == 0) {
+            break;
+        }
+        value = value * kPowersOfTenInt[count] + leadingValue(chunk, count);
+        p += count;
+        if (count < 8) {
+            break;
+        }
+    }
+    return static_cast<size_t>(p - start);
+}
+
+// 낮은 count바이트만 남기는 마스크 (count는 0..8)
+inline uint64_t lowBytes(unsigned count) {
+    return (count >= 8) ? ~uint64_t(0) : (uint64_t(1) << (8 * count)) - 1;
+}
+
+/**
+ * 8바이트 이하 셀의 빠른 경로: 셀 전체를 한 번 읽어 '.' 위치를 찾고, '.'을 뺀 숫자들을 한 번에 변환합니다
+ * @param chunk 셀 바이트 (loadPadded())
+ * @param length 셀 길이 (1..8, 부호 제외)
+ * @param mantissa 숫자들의 값
+ * @param fraction '.' 뒤 자리 수
+ * @return 셀이 숫자와 많아야 하나의 '.'로만 되어 있고 숫자가 하나 이상이면 true
+ */
+inline bool parseShortDecimal(uint64_t chunk, unsigned length, uint64_t& mantissa, unsigned& fraction) {
+    const uint64_t valid = lowBytes(length);
+    const uint64_t x = (chunk ^ 0x2E2E2E2E2E2E2E2EULL) & valid;   // '.'인 바이트만 0
+    const uint64_t dots = (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL & valid;
+    const unsigned dot = (dots == 0) ? length : countTrailingZeros(dots) / 8;
+    // '.' 바이트를 빼고 뒤쪽을 한 칸 당김 (셀 뒤는 0이므로 당긴 자리도 숫자가 아닌 바이트)
+    const uint64_t below = lowBytes(dot);
+    const uint64_t merged = (chunk & below) | ((chunk >> (dots != 0 ? 8 : 0)) & ~below);
+    const unsigned count = length - (dots != 0);
+    if (count == 0 || leadingDigits(merged) < count) {
+        return false;
+    }
+    mantissa = leadingValue(merged, count);
+    fraction = length - dot - (dots != 0);
+    return true;
+}
+
+} // namespace
+
+bool parseInt64(std::string_view text, int64_t& value) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    const bool negative = (p != end && *p == '-');
+    p += negative;
+    const size_t digits = static_cast<size_t>(end - p);
+    if (digits == 0 || digits > kMaxDigits) {
+        return parseSlow(text, value);  // 빈 셀, 앞에 0이 많은 긴 숫자
+    }
+
+    uint64_t magnitude = 0;
+    if (digits <= 8) {
+        // 한 번 읽어 모든 자리를 검사하고 변환
+        const uint64_t chunk = loadPadded(p, end);
+        if (leadingDigits(chunk) < digits) {
+            return false;
+        }
+        magnitude = leadingValue(chunk, static_cast<unsigned>(digits));
+    } else if (appendDigits(p, end, magnitude) != digits) {
+        return false;  // 숫자가 아닌 글자 (std::from_chars도 셀 전체를 읽지 못함)
+    }
+    if (magnitude > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + negative) {
+        return false;
+    }
+    value = negative ? static_cast<int64_t>(~magnitude + 1) : static_cast<int64_t>(magnitude);
+    return true;
+}
+
+bool parseDouble(std::string_view text, double& value) {
+    if (!kExactArithmetic) {
+        return parseSlow(text, value);
+    }
+    const char* p = text.data();
+    const char* end = p + text.size();
+    const bool negative = (p != end && *p == '-');
+    p += negative;
+
+    if (p != end && end - p <= 8) {
+        uint64_t mantissa = 0;
+        unsigned fraction = 0;
+        if (parseShortDecimal(loadPadded(p, end), static_cast<unsigned>(end - p), mantissa, fraction)) {
+            // 가수 < 10^8 < 2^53, 10^fraction은 정확하므로 나눗셈 한 번이 올바른 반올림
+            const double result = static_cast<double>(mantissa) / kPowersOfTen[fraction];
+            value = negative ? -result : result;
+            return true;
+        }
+    }
+
+    // 가수: 앞의 0은 유효 숫자로 세지 않음
+    const char* integer_begin = p;
+    while (p != end && *p == '0') {
+        ++p;
+    }
+    uint64_t mantissa = 0;
+    size_t significant = appendDigits(p, end, mantissa);
+    size_t digits = static_cast<size_t>(p - integer_begin);
+    int64_t exponent = 0;
+    if (p != end && *p == '.') {
+        ++p;
+        const char* fraction_begin = p;
+        if (significant == 0) {
+            while (p != end && *p == '0') {
+                ++p;
+            }
+        }
+        significant += appendDigits(p, end, mantissa);
+        digits += static_cast<size_t>(p - fraction_begin);
+        exponent = -static_cast<int64_t>(p - fraction_begin);
+    }
+    if (digits == 0) {
+        return parseSlow(text, value);  // inf, nan, 숫자가 아닌 셀
+    }
+
+    // 지수
+    if (p != end) {
+        if (*p != 'e' && *p != 'E') {
+            return parseSlow(text, value);
+        }
+        ++p;
+        const bool negative_exponent = (p != end && *p == '-');
+        p += (p != end && (*p == '-' || *p == '+'));
+        const char* exponent_begin = p;
+        uint64_t magnitude = 0;
+        while (p != end && isDigit(*p) && magnitude < kMaxExponent) {
+            magnitude = magnitude * 10 + static_cast<uint64_t>(*p - '0');
+            ++p;
+        }
+        if (p == exponent_begin || p != end) {
+            return parseSlow(text, value);
+        }
+        exponent += negative_exponent ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+    }
+
+    if (mantissa == 0 && significant == 0) {
+        value = negative ? -0.0 : 0.0;
+        return true;
+    }
+    if (significant > kMaxDigits) {
+        return parseSlow(text, value);  // 가수가 64비트를 넘을 수 있음
+    }
+    double result;
+    if (mantissa <= kMaxExactMantissa && exponent >= -kMaxExactPower && exponent <= kMaxExactPower) {
+        // 가수와 10^|exponent|가 모두 정확하므로 곱셈/나눗셈 한 번의 반올림 = 올바른 반올림
+        result = static_cast<double>(mantissa);
+        result = (exponent < 0) ? result / kPowersOfTen[-exponent] : result * kPowersOfTen[exponent];
+    } else if (!eiselLemire(mantissa, exponent, result)) {
+        return parseSlow(text, value);
+    }
+    value = negative ? -result : result;
+    return true;
+}
+
+size_t parseInt64s(const std::string_view* cells, size_t count, int64_t* out) {
+    for (size_t i = 0; i < count; ++i) {
+        if (!parseInt64(cells[i], out[i])) {
+            return i;
+        }
+    }
+    return count;
+}
+
+size_t parseDoubles(const std::string_view* cells, size_t count, double* out) {
+    for (size_t i = 0; i < count; ++i) {
+        if (!parseDouble(cells[i], out[i])) {
+            return i;
+        }
+    }
+    return count;
+}
+
+} // namespace mylib
@@ -0,0 +1,31 @@
+#ifndef CSV_ORDER_KEY_HPP
+#define CSV_ORDER_KEY_HPP
+
+// 내부 전용 헤더: 숫자 정렬 키 (sortOrder()의 기수 정렬과 외부 정렬의 병합이 같은 순서를 쓰도록)
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace mylib {
+namespace detail {
+
+// 정수를 부호 없는 순서 키로 바꿉니다 (부호 비트를 뒤집으면 음수가 앞에 옴)
+inline uint64_t orderKey(int64_t value) {
+    return static_cast<uint64_t>(value) ^ (uint64_t(1) << 63);
+}
+
+// 실수를 부호 없는 순서 키로 바꿉니다 (음수는 모든 비트, 양수는 부호 비트만 뒤집음)
+inline uint64_t orderKey(double value) {
+    if (value != value) {
+        return std::numeric_limits<uint64_t>::max();  // NaN은 부호와 상관없이 맨 뒤
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & (uint64_t(1) << 63)) ? ~bits : (bits | (uint64_t(1) << 63));
+}
+
+} // namespace detail
+} // namespace mylib
+
+#endif // CSV_ORDER_KEY_HPP
@@ -1,93 +1,684 @@
 #include "cpp/mylib/CSVParser.hpp"
-#include <fstream>
-#include <sstream>
+#include "cpp/mylib/CSVReader.hpp"
+#include "cpp/mylib/CSVWriter.hpp"
+#include "cpp/mylib/MappedFile.hpp"
+#include "cpp/mylib/ThreadPool.hpp"
+#include "mylib/csv_read_files.h"
+#include "mylib/csv_snapshot.h"
+#include "CSVFields.hpp"
+#include "CSVLazyRows.hpp"
 #include <iostream>
 #include <algorithm>
+#include <new>
 
 namespace mylib {
 
+namespace {
+
+using detail::RecordBuffer;
+using detail::decodeField;
+using detail::decodeFieldInPlace;
+using detail::projectHeaders;
+using detail::readHeader;
+using detail::resolveColumns;
+
+// 스레드 하나가 맡을 최소 바이트 수 (이보다 작은 파일은 나누지 않음)
+constexpr size_t kMinChunkBytes = 64 * 1024;
+
+// parseMany()가 한 번에 메모리로 읽는 파일 수 (메모리 사용량 상한)
+constexpr size_t kFilesPerBatch = 256;
+
+// RowPlan::reuse에서 재사용할 값이 없음을 뜻함
+constexpr size_t kNoReuse = static_cast<size_t>(-1);
+
+// 청크 파싱 계획: 어떤 필드를 어떤 순서로 읽고 어떤 조건으로 거를지
+struct RowPlan {
+    std::vector<size_t> source;                  // 결과 열별 원본 필드 인덱스 (비어 있으면 같은 위치)
+    const std::vector<CSVPredicate>* filters = nullptr;
+    std::vector<size_t> filter_slot;             // 조건별 공유 값 번호
+    std::vector<size_t> shared_source;           // 레코드마다 한 번만 복원해 함께 쓰는 원본 필드 (조건 열이 앞)
+    std::vector<size_t> reuse;                   // 결과 열별 공유 값 번호 (없으면 kNoReuse)
+};
+
+// [data, data + length) 구간의 레코드를 모두 파싱하여 out에 추가합니다
+void parseChunk(const char* data, size_t length, bool in_place, const RowPlan& plan, CSVTable& out) {
+    CSVTokenizer tokenizer;
+    csv_tokenizer_init(&tokenizer, data, length, 1);
+    RecordBuffer buffer;
+    std::string scratch;
+    const size_t filter_count = plan.filter_slot.size();
+    const size_t shared_count = plan.shared_source.size();
+    std::vector<std::string> shared_scratch(shared_count);
+    std::vector<std::string_view> shared_values(shared_count);
+    int status;
+
+    while ((status = csv_tokenizer_next(&tokenizer, &buffer.record)) == 1) {
+        const CSVRecord& record = buffer.record;
+
+        // 제자리 복원은 필드마다 한 번만 할 수 있으므로 여러 곳에서 쓰는 필드는 앞에서부터 한 번씩 복원해 공유
+        size_t decoded = 0;
+        auto shared = [&](size_t slot) {
+            for (; decoded <= slot; ++decoded) {
+                const size_t index = plan.shared_source[decoded];
+                std::string_view value;
+                if (index < record.count) {
+                    const CSVField& field = record.fields[index];
+                    value = in_place ? decodeFieldInPlace(field) : decodeField(field, shared_scratch[decoded]);
+                }
+                shared_values[decoded] = value;
+            }
+            return shared_values[slot];
+        };
+
+        // 조건 열을 먼저 복원하고, 하나라도 실패하면 나머지 필드는 건드리지 않음
+        bool keep = true;
+        for (size_t k = 0; keep && k < filter_count; ++k) {
+            keep = (*plan.filters)[k].matches(shared(plan.filter_slot[k]));
+        }
+        if (!keep) {
+            continue;
+        }
+
+        for (size_t col = 0; col < out.colCount(); ++col) {
+            if (!plan.reuse.empty() && plan.reuse[col] != kNoReuse) {
+                out.column(col).append(shared(plan.reuse[col]));
+                continue;
+            }
+            const size_t index = plan.source.empty() ? col : plan.source[col];
+            std::string_view value;
+            if (index < record.count) {
+                const CSVField& field = record.fields[index];
+                value = in_place ? decodeFieldInPlace(field) : decodeField(field, scratch);
+            }
+            out.column(col).append(value);
+        }
+    }
+
+    if (status < 0) {
+        throw std::bad_alloc();
+    }
+}
+
+// csv_read_files() 결과 배열 (소멸 시 버퍼 해제)
+struct FileBuffers {
+    std::vector<CSVFileBuffer> items;
+
+    explicit FileBuffers(size_t count) : items(count) {}
+    ~FileBuffers() { csv_file_buffers_free(items.data(), items.size()); }
+
+    FileBuffers(const FileBuffers&) = delete;
+    FileBuffers& operator=(const FileBuffers&) = delete;
+};
+
+// 원본 헤더와 옵션으로 파싱 계획을 만듭니다 (plan.filters는 options.filters를 가리킴)
+RowPlan makePlan(const std::vector<std::string>& headers, const ParseOptions& options) {
+    RowPlan plan;
+    plan.source = resolveColumns(headers, options.columns);
+
+    // 원본 필드를 공유 값으로 등록 (이미 있으면 그 번호)
+    auto share = [&plan](size_t index) {
+        auto it = std::find(plan.shared_source.begin(), plan.shared_source.end(), index);
+        if (it != plan.shared_source.end()) {
+            return static_cast<size_t>(it - plan.shared_source.begin());
+        }
+        plan.shared_source.push_back(index);
+        return plan.shared_source.size() - 1;
+    };
+
+    if (!options.filters.empty()) {
+        plan.filters = &options.filters;
+        for (const auto& filter : options.filters) {
+            // 같은 열에 조건이 여럿이어도 (범위 조건 등) 필드는 한 번만 복원
+            plan.filter_slot.push_back(share(resolveColumns(headers, {filter.column()})[0]));
+        }
+    }
+
+    // 조건 열이거나 프로젝션에 두 번 이상 나오는 열은 공유 값을 씀
+    const size_t width = plan.source.empty() ? headers.size() : plan.source.size();
+    std::vector<size_t> reuse(width, kNoReuse);
+    bool any = false;
+    const size_t filtered = plan.shared_source.size();
+    for (size_t col = 0; col < width; ++col) {
+        const size_t index = plan.source.empty() ? col : plan.source[col];
+        const auto first = std::find(plan.shared_source.begin(), plan.shared_source.begin() + filtered, index);
+        if (first != plan.shared_source.begin() + filtered ||
+            std::count(plan.source.begin(), plan.source.end(), index) > 1) {
+            reuse[col] = share(index);
+            any = true;
+        }
+    }
+    if (any) {
+        plan.reuse = std::move(reuse);
+    }
+    return plan;
+}
+
+// text의 [begin, end) 구간(레코드 시작에서 시작)을 스레드 풀로 나누어 파싱합니다
+CSVTable parseRange(const char* text, size_t begin, size_t end, const std::vector<std::string>& headers,
+                    const RowPlan& plan, size_t threads, bool in_place, const char* borrowed) {
+    if (threads == 0) {
+        threads = ThreadPool::defaultThreadCount();
+    }
+    const size_t chunk_count = std::max<size_t>(1, std::min(threads, (end - begin) / kMinChunkBytes));
+
+    std::vector<size_t> bounds(chunk_count + 1);
+    std::vector<CSVTable> chunks(chunk_count, CSVTable(headers, borrowed));
+    csv_chunk_plan(begin, end, chunk_count, bounds.data());
+
+    if (chunk_count == 1) {
+        parseChunk(text + bounds[0], bounds[1] - bounds[0], in_place, plan, chunks[0]);
+    } else {
+        ThreadPool pool(chunk_count);
+
+        // 1단계: 균등 구간별 따옴표 개수 → 레코드 경계로 정렬
+        std::vector<size_t> quote_counts(chunk_count);
+        pool.parallelFor(chunk_count, [&](size_t i) {
+            quote_counts[i] = csv_scan_count_quotes(text + bounds[i], bounds[i + 1] - bounds[i]);
+        });
+        csv_chunk_align(text, chunk_count, quote_counts.data(), bounds.data());
+
+        // 2단계: 청크별 병렬 파싱
+        pool.parallelFor(chunk_count, [&](size_t i) {
+            parseChunk(text + bounds[i], bounds[i + 1] - bounds[i], in_place, plan, chunks[i]);
+        });
+    }
+
+    // 3단계: 청크 순서대로 열을 이어 붙임 (Mapped 모드는 오프셋만 복사)
+    CSVTable table = std::move(chunks[0]);
+    for (size_t i = 1; i < chunk_count; ++i) {
+        table.appendTable(std::move(chunks[i]));
+    }
+    return table;
+}
+
+/**
+ * [begin, end)에서 완성된 레코드가 끝나는 위치를 찾습니다
+ *
+ * 뒤에서부터 줄 끝("\n" 또는 "\r")을 찾되, 그 앞의 따옴표 개수가 짝수일 때만(따옴표 필드 밖) 레코드 끝으로 봅니다.
+ * 아직 쓰는 중인 마지막 줄은 건너뛰므로 다음 refresh()에서 온전히 읽힙니다.
+ * 마지막 바이트가 "\r"이면 "\r\n"의 앞쪽일 수 있으므로 다음 바이트가 올 때까지 기다립니다.
+ */
+size_t completeEnd(const char* text, size_t begin, size_t end) {
+    if (begin >= end) {
+        return begin;
+    }
+    const size_t total = csv_scan_count_quotes(text + begin, end - begin);
+    size_t after = 0;
+    for (size_t pos = end; pos > begin; --pos) {
+        const char c = text[pos - 1];
+        if (c == '"') {
+            ++after;
+        } else if ((c == '\n' || (c == '\r' && pos < end)) && (total - after) % 2 == 0) {
+            return pos;
+        }
+    }
+    return begin;
+}
+
+} // namespace
+
 void CSVParser::parse(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open file: " + filename);
+    parse(filename, ParseOptions());
+}
+
+void CSVParser::parse(const std::string& filename, ParseMode mode) {
+    ParseOptions options;
+    options.mode = mode;
+    parse(filename, options);
+}
+
+void CSVParser::parse(const std::string& filename, const std::vector<std::string>& columns) {
+    ParseOptions options;
+    options.columns = columns;
+    parse(filename, options);
+}
+
+void CSVParser::parse(const std::string& filename, const ParseOptions& options) {
+    if (options.mode == ParseMode::Lazy) {
+        if (!options.filters.empty()) {
+            throw std::invalid_argument("Lazy mode does not support filters");
+        }
+        lazy_ = std::make_shared<const detail::LazyRows>(filename, options);
+        table_ = CSVTable();
+        mapping_.reset();
+        follow_ = FollowState();
+        return;
+    }
+
+    // 조건 필터는 청크 파서에서 토큰화와 함께 평가 (threads == 1이면 청크 하나)
+    if (options.mode == ParseMode::Mapped || options.threads != 1 || !options.filters.empty()) {
+        parseChunked(filename, options);
+    } else {
+        CSVReader reader(filename, options.columns);
+        CSVTable table(reader.headers());
+
+        while (reader.next()) {
+            table.appendRow(reader.row());
+        }
+
+        table_ = std::move(table);
+        mapping_.reset();
     }
+    follow_ = FollowState();
+    lazy_.reset();
+
+    finishColumns(options);
+}
 
-    headers_.clear();
-    rows_.clear();
+void CSVParser::finishColumns(const ParseOptions& options) {
+    if (!options.infer_types && options.dictionary_max_distinct == 0) {
+        return;
+    }
 
-    std::string line;
-    bool is_header = true;
+    // 타입 추론 뒤에도 문자열로 남은 열만 사전 인코딩 대상
+    auto finish = [&](size_t col) {
+        CSVTable::Column& column = table_.column(col);
+        if (options.infer_types) {
+            column.infer(options.infer_sample_rows);
+        }
+        if (options.dictionary_max_distinct != 0) {
+            column.encodeDictionary(options.dictionary_max_distinct);
+        }
+    };
 
-    while (std::getline(file, line)) {
-        // 빈 줄 건너뛰기
-        if (line.empty()) {
-            continue;
+    const size_t threads = (options.threads == 0) ? ThreadPool::defaultThreadCount() : options.threads;
+    const size_t workers = std::min(threads, colCount());
+    if (workers <= 1) {
+        for (size_t col = 0; col < colCount(); ++col) {
+            finish(col);
+        }
+        return;
+    }
+
+    // 열끼리는 독립적이므로 열 단위로 나누어 변환
+    ThreadPool pool(workers);
+    pool.parallelFor(colCount(), finish);
+}
+
+size_t CSVParser::forEachRow(const std::string& filename, const RowCallback& callback) {
+    CSVReader reader(filename);
+    size_t visited = 0;
+
+    while (reader.next()) {
+        ++visited;
+        if (!callback(reader.row())) {
+            break;
         }
+    }
+    return visited;
+}
+
+void CSVParser::buildIndex(const std::string& filename, size_t stride, size_t threads) {
+    detail::LazyRows::writeIndex(filename, stride, threads);
+}
+
+void CSVParser::parseChunked(const std::string& filename, const ParseOptions& options) {
+    const bool in_place = (options.mode == ParseMode::Mapped);
+
+    // Mapped 모드는 따옴표 필드를 제자리에서 복원할 수 있도록 copy-on-write로 매핑합니다.
+    // 매핑에 실패하면 기존 데이터는 그대로 둡니다
+    auto mapping = std::make_shared<MappedFile>(filename, in_place);
+    const char* text = mapping->data();
+    const size_t size = mapping->size();
+
+    // 헤더는 순차적으로 읽음
+    CSVTokenizer tokenizer;
+    csv_tokenizer_init(&tokenizer, text, size, 1);
+    RecordBuffer buffer;
+    int status = csv_tokenizer_next(&tokenizer, &buffer.record);
+    if (status < 0) {
+        throw std::bad_alloc();
+    }
+    std::vector<std::string> headers;
+    for (size_t i = 0; status == 1 && i < buffer.record.count; ++i) {
+        const CSVField& field = buffer.record.fields[i];
+        headers.push_back(in_place ? std::string(decodeFieldInPlace(field)) : decodeField(field));
+    }
+
+    RowPlan plan = makePlan(headers, options);
+    headers = projectHeaders(headers, plan.source);
+
+    const char* borrowed = in_place ? text : nullptr;
+    CSVTable table = parseRange(text, tokenizer.pos, size, headers, plan, options.threads, in_place, borrowed);
+
+    table_ = std::move(table);
+    mapping_ = in_place ? std::move(mapping) : nullptr;
+}
+
+void CSVParser::parseMany(const std::vector<std::string>& paths, const ParseOptions& options) {
+    const size_t threads = (options.threads == 0) ? ThreadPool::defaultThreadCount() : options.threads;
+    std::unique_ptr<ThreadPool> pool;
+    if (threads > 1 && paths.size() > 1) {
+        pool = std::make_unique<ThreadPool>(std::min(threads, paths.size()));
+    }
+
+    std::vector<const char*> c_paths;
+    c_paths.reserve(paths.size());
+    for (const auto& path : paths) {
+        c_paths.push_back(path.c_str());
+    }
 
-        std::vector<std::string> row;
-        std::stringstream ss(line);
-        std::string cell;
+    CSVTable table;
+    bool have_headers = false;
+    for (size_t first = 0; first < paths.size(); first += kFilesPerBatch) {
+        const size_t count = std::min(kFilesPerBatch, paths.size() - first);
 
-        while (std::getline(ss, cell, ',')) {
-            // 앞뒤 공백 제거
-            cell.erase(0, cell.find_first_not_of(" \t\r\n"));
-            cell.erase(cell.find_last_not_of(" \t\r\n") + 1);
-            row.push_back(cell);
+        // 묶음 단위로 읽기 (io_uring이면 파일 64개당 제출 세 번)
+        FileBuffers files(count);
+        std::vector<CSVFileBuffer>& buffers = files.items;
+        csv_read_files(c_paths.data() + first, count, buffers.data(), CSV_READ_AUTO);
+        for (size_t i = 0; i < count; ++i) {
+            if (buffers[i].error != 0) {
+                throw std::runtime_error("Failed to open file: " + paths[first + i]);
+            }
         }
 
-        if (is_header) {
-            headers_ = row;
-            is_header = false;
+        // 파일끼리는 독립적이므로 파일 단위로 나누어 파싱
+        std::vector<CSVTable> parsed(count);
+        auto parseFile = [&](size_t i) {
+            const char* text = buffers[i].data;
+            size_t begin = 0;
+            std::vector<std::string> headers = readHeader(text, begin, buffers[i].size);
+            if (headers.empty()) {
+                return;
+            }
+            const RowPlan plan = makePlan(headers, options);
+            parsed[i] = parseRange(text, begin, buffers[i].size, projectHeaders(headers, plan.source),
+                                   plan, 1, false, nullptr);
+        };
+        if (pool) {
+            pool->parallelFor(count, parseFile);
         } else {
-            rows_.push_back(row);
+            for (size_t i = 0; i < count; ++i) {
+                parseFile(i);
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            if (parsed[i].headers().empty()) {
+                continue;  // 빈 파일
+            }
+            if (!have_headers) {
+                table = std::move(parsed[i]);
+                have_headers = true;
+            } else if (parsed[i].headers() != table.headers()) {
+                throw std::runtime_error("Header mismatch: " + paths[first + i]);
+            } else {
+                table.appendTable(std::move(parsed[i]));
+            }
+        }
+    }
+
+    table_ = std::move(table);
+    mapping_.reset();
+    follow_ = FollowState();
+    lazy_.reset();
+
+    finishColumns(options);
+}
+
+void CSVParser::follow(const std::string& filename, const ParseOptions& options) {
+    FileReader file(filename);
+
+    FollowState state;
+    state.active = true;
+    state.filename = filename;
+    state.options = options;
+    state.options.mode = ParseMode::Copy;
+    state.device = file.identity().device;
+    state.inode = file.identity().inode;
+
+    follow_ = std::move(state);
+    table_ = CSVTable();
+    mapping_.reset();
+    lazy_.reset();
+    consumeAppended(file);
+}
+
+RefreshResult CSVParser::refresh() {
+    if (!follow_.active) {
+        throw std::logic_error("refresh() called without follow()");
+    }
+
+    // 쓰는 중인 파일은 매핑하지 않음 (copytruncate로 잘리면 매핑의 새 끝 너머를 만질 때 SIGBUS)
+    FileReader file(follow_.filename);
+    RefreshResult result;
+    const FileIdentity& identity = file.identity();
+    if (identity.device != follow_.device || identity.inode != follow_.inode || file.size() < follow_.offset) {
+        // 로테이션(새 파일) 또는 잘림: 기억한 위치가 의미 없으므로 처음부터
+        follow_.device = identity.device;
+        follow_.inode = identity.inode;
+        follow_.offset = 0;
+        follow_.headers.clear();
+        table_ = CSVTable();
+        result.reloaded = true;
+    }
+
+    result.rows = consumeAppended(file);
+    return result;
+}
+
+bool CSVParser::isFollowing() const {
+    return follow_.active;
+}
+
+size_t CSVParser::consumeAppended(const FileReader& file) {
+    // 기억한 위치 뒤의 새 부분만 읽음 (오프셋은 이 버퍼 기준, 읽는 중 잘렸으면 읽은 만큼만)
+    const uint64_t start = follow_.offset;
+    if (file.size() <= start) {
+        return 0;
+    }
+    std::string tail(static_cast<size_t>(file.size() - start), '\0');
+    tail.resize(file.read(start, &tail[0], tail.size()));
+
+    const char* text = tail.data();
+    const size_t end = completeEnd(text, 0, tail.size());
+    size_t begin = 0;
+    if (begin >= end) {
+        return 0;
+    }
+
+    // 헤더 줄을 아직 못 읽었으면 먼저 읽음
+    if (follow_.headers.empty()) {
+        std::vector<std::string> headers = readHeader(text, begin, end);
+        if (headers.empty()) {
+            follow_.offset = start + end;  // 빈 줄뿐이었음
+            return 0;
+        }
+
+        const RowPlan plan = makePlan(headers, follow_.options);
+        table_ = CSVTable(projectHeaders(headers, plan.source));
+        follow_.headers = std::move(headers);
+    }
+
+    const RowPlan plan = makePlan(follow_.headers, follow_.options);
+    CSVTable appended = parseRange(text, begin, end, table_.headers(), plan, follow_.options.threads, false, nullptr);
+    follow_.offset = start + end;
+
+    const size_t added = appended.rowCount();
+    const bool first_rows = (table_.rowCount() == 0);
+    if (!first_rows) {
+        // 이미 숫자로 변환된 열은 새 행도 같은 타입으로 (실패하면 appendTable이 문자열로 넓힘)
+        // 사전 열도 새 행을 인코딩해 사전끼리 합침 (값이 너무 많으면 appendTable이 사전을 풂)
+        for (size_t col = 0; col < table_.colCount(); ++col) {
+            const CSVTable::Column& column = table_.column(col);
+            if (column.type() != ColumnType::String) {
+                appended.column(col).convert(column.type());
+            } else if (column.isDictionary()) {
+                appended.column(col).encodeDictionary(follow_.options.dictionary_max_distinct);
+            }
         }
     }
+    table_.appendTable(std::move(appended));
 
-    file.close();
+    if (first_rows) {
+        finishColumns(follow_.options);
+    } else if (follow_.options.dictionary_max_distinct != 0) {
+        // 합친 사전이 한도를 넘으면 보통 열로 되돌림
+        for (size_t col = 0; col < table_.colCount(); ++col) {
+            CSVTable::Column& column = table_.column(col);
+            if (column.dictionarySize() > follow_.options.dictionary_max_distinct) {
+                column.decodeDictionary();
+            }
+        }
+    }
+    return added;
 }
 
 std::string CSVParser::get(size_t row, size_t col) const {
-    if (row >= rows_.size()) {
+    return std::string(getView(row, col));
+}
+
+std::string_view CSVParser::getView(size_t row, size_t col) const {
+    if (!lazy_) {
+        return table_.get(row, col);
+    }
+    if (row >= lazy_->rowCount()) {
         throw std::out_of_range("Row index out of range");
     }
-    if (col >= rows_[row].size()) {
+    if (col >= lazy_->headers().size()) {
         throw std::out_of_range("Column index out of range");
     }
-    return rows_[row][col];
+    return lazy_->row(row)->cells[col];
 }
 
 size_t CSVParser::findColumn(const std::string& header_name) const {
-    auto it = std::find(headers_.begin(), headers_.end(), header_name);
-    if (it == headers_.end()) {
-        throw std::runtime_error("Header not found: " + header_name);
+    if (!lazy_) {
+        return table_.findColumn(header_name);
     }
-    return std::distance(headers_.begin(), it);
+    return detail::resolveColumns(lazy_->headers(), {header_name})[0];
+}
+
+const CSVTable::Column& CSVParser::column(const std::string& header_name) const {
+    return loaded().column(header_name);
+}
+
+bool CSVParser::convertColumn(const std::string& header_name, ColumnType type) {
+    return loaded().convertColumn(findColumn(header_name), type);
+}
+
+int64_t CSVParser::getInt(size_t row, size_t col) const {
+    return loaded().getInt(row, col);
+}
+
+double CSVParser::getDouble(size_t row, size_t col) const {
+    return loaded().getDouble(row, col);
+}
+
+std::vector<double> CSVParser::aggregate(const std::string& header_name,
+                                         const std::vector<AggregateOp>& ops) const {
+    return loaded().aggregate(header_name, ops);
+}
+
+CSVTable CSVParser::groupBy(const std::vector<std::string>& keys, const std::vector<GroupAggregate>& aggregates,
+                            size_t threads) const {
+    return loaded().groupBy(keys, aggregates, threads);
+}
+
+CSVTable CSVParser::join(const CSVParser& right, const std::string& left_key, const std::string& right_key,
+                         const JoinOptions& options) const {
+    return loaded().join(right.loaded(), left_key, right_key, options);
+}
+
+void CSVParser::sortBy(const std::string& header_name, SortOrder order, size_t threads) {
+    loaded().sortBy({SortKey{header_name, order}}, threads);
+}
+
+void CSVParser::sortBy(const std::vector<SortKey>& keys, size_t threads) {
+    loaded().sortBy(keys, threads);
+}
+
+std::vector<uint32_t> CSVParser::select(const std::vector<CSVPredicate>& predicates) const {
+    return loaded().select(predicates);
 }
 
 std::vector<std::string> CSVParser::getRow(size_t row) const {
-    if (row >= rows_.size()) {
+    std::vector<std::string_view> views = getRowView(row);
+    return std::vector<std::string>(views.begin(), views.end());
+}
+
+std::vector<std::string_view> CSVParser::getRowView(size_t row) const {
+    if (row >= rowCount()) {
         throw std::out_of_range("Row index out of range");
     }
-    return rows_[row];
+    if (lazy_) {
+        return lazy_->row(row)->cells;
+    }
+    std::vector<std::string_view> result;
+    result.reserve(colCount());
+    for (size_t col = 0; col < colCount(); ++col) {
+        result.push_back(table_.column(col)[row]);
+    }
+    return result;
+}
+
+bool CSVParser::isMapped() const {
+    return mapping_ != nullptr;
+}
+
+bool CSVParser::isLazy() const {
+    return lazy_ != nullptr;
+}
+
+bool CSVParser::usesRowIndex() const {
+    return lazy_ && lazy_->usesSidecar();
+}
+
+void CSVParser::materialize() {
+    if (lazy_) {
+        // 색인할 때 읽은 매핑을 그대로 파싱 (헤더는 색인할 때 건너뛴 위치부터)
+        const ParseOptions options = lazy_->options();
+        const char* text = lazy_->file().data();
+        size_t begin = 0;
+        const std::vector<std::string> headers = readHeader(text, begin, lazy_->file().size());
+        const RowPlan plan = makePlan(headers, options);
+        table_ = parseRange(text, begin, lazy_->file().size(), projectHeaders(headers, plan.source), plan,
+                            options.threads, false, nullptr);
+        lazy_.reset();
+        finishColumns(options);
+        return;
+    }
+    if (!mapping_) {
+        return;
+    }
+
+    table_.materialize();
+    mapping_.reset();
+}
+
+const CSVTable& CSVParser::loaded() const {
+    if (lazy_) {
+        throw std::logic_error("Lazy parser has no table; call materialize() first");
+    }
+    return table_;
+}
+
+CSVTable& CSVParser::loaded() {
+    if (lazy_) {
+        throw std::logic_error("Lazy parser has no table; call materialize() first");
+    }
+    return table_;
 }
 
 void CSVParser::print() const {
     // 헤더 출력
     std::cout << "Headers: ";
-    for (size_t i = 0; i < headers_.size(); ++i) {
-        std::cout << headers_[i];
-        if (i < headers_.size() - 1) {
+    const auto& headers = this->headers();
+    for (size_t i = 0; i < headers.size(); ++i) {
+        std::cout << headers[i];
+        if (i < headers.size() - 1) {
             std::cout << ", ";
         }
     }
     std::cout << "\n\n";
 
     // 데이터 출력
-    for (size_t i = 0; i < rows_.size(); ++i) {
+    for (size_t i = 0; i < rowCount(); ++i) {
+        const std::vector<std::string_view> row = getRowView(i);
         std::cout << "Row " << i << ": ";
-        for (size_t j = 0; j < rows_[i].size(); ++j) {
-            std::cout << rows_[i][j];
-            if (j < rows_[i].size() - 1) {
+        for (size_t j = 0; j < colCount(); ++j) {
+            std::cout << row[j];
+            if (j < colCount() - 1) {
                 std::cout << ", ";
             }
         }
@@ -95,45 +686,99 @@ void CSVParser::print() const {
     }
 }
 
-void CSVParser::write(const std::string& filename) const {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open file for writing: " + filename);
-    }
+void CSVParser::write(const std::string& filename, const WriteOptions& options) const {
+    CSVWriter writer(filename, options);
+    writer.writeTable(loaded());
+    writer.close();
+}
+
+namespace {
+
+// saveSnapshot()에서 쓰는 셀 콜백
+const char* snapshotCell(void* user, size_t row, size_t col, size_t* length) {
+    const CSVTable& table = *static_cast<const CSVTable*>(user);
+    std::string_view cell = table.column(col)[row];
+    *length = cell.size();
+    return cell.data();
+}
 
-    // 헤더 쓰기
-    for (size_t i = 0; i < headers_.size(); ++i) {
-        file << headers_[i];
-        if (i < headers_.size() - 1) {
-            file << ",";
+} // namespace
+
+void CSVParser::saveSnapshot(const std::string& filename) const {
+    const CSVTable& table = loaded();
+    std::vector<CSVSnapshotSource> columns(table.colCount());
+    for (size_t col = 0; col < table.colCount(); ++col) {
+        const CSVTable::Column& column = table.column(col);
+        const std::string& name = table.headers()[col];
+        columns[col].name = name.c_str();
+        columns[col].name_length = name.size();
+        columns[col].type = static_cast<uint32_t>(column.type());
+        switch (column.type()) {
+            case ColumnType::Int64:
+                columns[col].values = column.ints().data();
+                break;
+            case ColumnType::Double:
+                columns[col].values = column.doubles().data();
+                break;
+            default:
+                columns[col].values = nullptr;
+                break;
         }
     }
-    file << "\n";
 
-    // 데이터 쓰기
-    for (const auto& row : rows_) {
-        for (size_t i = 0; i < row.size(); ++i) {
-            file << row[i];
-            if (i < row.size() - 1) {
-                file << ",";
-            }
-        }
-        file << "\n";
+    if (csv_snapshot_write(filename.c_str(), rowCount(), colCount(), columns.data(),
+                           snapshotCell, const_cast<CSVTable*>(&table_)) != 0) {
+        throw std::runtime_error("Failed to write snapshot: " + filename);
+    }
+}
+
+void CSVParser::loadSnapshot(const std::string& filename, bool verify_checksum) {
+    auto mapping = std::make_shared<const MappedFile>(filename, false, AccessPattern::Normal);
+    if (csv_snapshot_validate(mapping->data(), mapping->size(), verify_checksum ? 1 : 0) != 0) {
+        throw std::runtime_error("Invalid snapshot: " + filename);
     }
 
-    file.close();
+    // 검사를 통과했으므로 모든 배열이 파일 안에 있고 정렬되어 있음
+    const char* base = mapping->data();
+    const auto* header = reinterpret_cast<const CSVSnapshotHeader*>(base);
+    const auto* directory = reinterpret_cast<const CSVSnapshotColumn*>(base + sizeof(CSVSnapshotHeader));
+    size_t rows = static_cast<size_t>(header->row_count);
+    size_t cols = static_cast<size_t>(header->col_count);
+
+    std::vector<std::string> headers;
+    std::vector<CSVTable::Column> columns(cols);
+    headers.reserve(cols);
+    for (size_t col = 0; col < cols; ++col) {
+        const CSVSnapshotColumn& entry = directory[col];
+        headers.emplace_back(base + entry.name_offset, static_cast<size_t>(entry.name_length));
+        columns[col].borrowArrays(base + entry.heap_offset,
+                                  reinterpret_cast<const uint64_t*>(base + entry.offsets_offset),
+                                  reinterpret_cast<const uint32_t*>(base + entry.lengths_offset),
+                                  rows, static_cast<ColumnType>(entry.type),
+                                  entry.type != CSV_SNAPSHOT_STRING ? base + entry.values_offset : nullptr,
+                                  entry.heap_size);
+    }
+
+    table_ = CSVTable(std::move(headers), std::move(columns));
+    mapping_ = std::move(mapping);
+    follow_ = FollowState();
+    lazy_.reset();
 }
 
 size_t CSVParser::rowCount() const {
-    return rows_.size();
+    return lazy_ ? lazy_->rowCount() : table_.rowCount();
 }
 
 size_t CSVParser::colCount() const {
-    return headers_.size();
+    return lazy_ ? lazy_->headers().size() : table_.colCount();
 }
 
 const std::vector<std::string>& CSVParser::headers() const {
-    return headers_;
+    return lazy_ ? lazy_->headers() : table_.headers();
+}
+
+const CSVTable& CSVParser::table() const {
+    return loaded();
 }
 
 } // namespace mylib
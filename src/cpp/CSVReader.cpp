@@ -0,0 +1,136 @@
+#include "cpp/mylib/CSVReader.hpp"
+#include "mylib/csv_parser.h"
+#include "CSVFields.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace mylib {
+
+CSVReader::CSVReader(const std::string& filename, const std::vector<std::string>& columns)
+    : stream_(csv_stream_open(filename.c_str())) {
+    if (stream_ == nullptr) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    size_t count = 0;
+    char** headers = csv_stream_headers(stream_, &count);
+    headers_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        headers_.emplace_back(detail::trim(headers[i]));
+    }
+
+    try {
+        columns_ = detail::resolveColumns(headers_, columns);
+    } catch (...) {
+        close();
+        throw;
+    }
+    headers_ = detail::projectHeaders(headers_, columns_);
+
+    // 같은 열을 두 번 고르면 제자리 복원을 한 번만 하고 앞의 값을 재사용
+    repeats_.resize(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        repeats_[i] = static_cast<size_t>(std::find(columns_.begin(), columns_.end(), columns_[i]) - columns_.begin());
+    }
+}
+
+CSVReader::~CSVReader() {
+    close();
+}
+
+CSVReader::CSVReader(CSVReader&& other) noexcept
+    : stream_(other.stream_)
+    , headers_(std::move(other.headers_))
+    , columns_(std::move(other.columns_))
+    , repeats_(std::move(other.repeats_))
+    , row_(std::move(other.row_)) {
+    other.stream_ = nullptr;
+}
+
+CSVReader& CSVReader::operator=(CSVReader&& other) noexcept {
+    if (this != &other) {
+        close();
+
+        stream_ = other.stream_;
+        headers_ = std::move(other.headers_);
+        columns_ = std::move(other.columns_);
+        repeats_ = std::move(other.repeats_);
+        row_ = std::move(other.row_);
+
+        other.stream_ = nullptr;
+    }
+    return *this;
+}
+
+void CSVReader::close() {
+    csv_stream_close(stream_);
+    stream_ = nullptr;
+}
+
+const std::vector<std::string>& CSVReader::headers() const {
+    return headers_;
+}
+
+bool CSVReader::next() {
+    row_.clear();
+    if (stream_ == nullptr) {
+        return false;
+    }
+
+    const CSVRecord* record = nullptr;
+    int status = csv_stream_next_record(stream_, &record);
+    if (status < 0) {
+        throw std::runtime_error("Failed to read CSV stream");
+    }
+    if (status == 0) {
+        return false;
+    }
+
+    // 스트림 버퍼는 다음 행까지 수정 가능하므로 제자리에서 따옴표를 풉니다
+    if (columns_.empty()) {
+        for (size_t i = 0; i < record->count; ++i) {
+            row_.push_back(detail::decodeFieldInPlace(record->fields[i]));
+        }
+        return true;
+    }
+
+    // 프로젝션: 선택한 필드만 복원
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        const size_t index = columns_[i];
+        if (repeats_[i] != i) {
+            const std::string_view repeated = row_[repeats_[i]];
+            row_.push_back(repeated);
+        } else {
+            row_.push_back(index < record->count ? detail::decodeFieldInPlace(record->fields[index])
+                                                 : std::string_view());
+        }
+    }
+    return true;
+}
+
+const std::vector<std::string_view>& CSVReader::row() const {
+    return row_;
+}
+
+IOStats CSVReader::ioStats() const {
+    IOStats result;
+    CSVReadAheadStats stats;
+    if (csv_stream_io_stats(stream_, &stats) == 0) {
+        result.bytes_read = stats.bytes_read;
+        result.blocks_read = stats.blocks_read;
+        result.producer_stall_ns = stats.producer_stall_ns;
+        result.consumer_stall_ns = stats.consumer_stall_ns;
+        result.threaded = stats.threaded != 0;
+    }
+    return result;
+}
+
+CSVReader::Iterator CSVReader::begin() {
+    return next() ? Iterator(this) : Iterator();
+}
+
+CSVReader::Iterator CSVReader::end() {
+    return Iterator();
+}
+
+} // namespace mylib
@@ -0,0 +1,191 @@
+#include "cpp/mylib/CSVTable.hpp"
+#include "cpp/mylib/ThreadPool.hpp"
+#include "CSVOrderKey.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace mylib {
+
+namespace {
+
+using detail::orderKey;
+
+// 스레드 하나가 맡을 최소 행 수 (이보다 작으면 나누지 않음)
+constexpr size_t kMinRowsPerThread = 64 * 1024;
+
+/**
+ * order를 keyOf(order[i])로 안정 정렬합니다 (LSD 기수 정렬, 8비트 × 8회)
+ *
+ * 모든 키의 해당 바이트가 같으면 그 회차는 건너뛰므로, 값의 범위가 좁을수록 빨라집니다.
+ */
+template <typename KeyOf>
+void radixSort(KeyOf keyOf, std::vector<uint32_t>& order, bool descending) {
+    const size_t n = order.size();
+    std::vector<uint64_t> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t key = keyOf(order[i]);
+        keys[i] = descending ? ~key : key;
+    }
+
+    // 8개 바이트의 히스토그램을 한 번에 구함
+    std::vector<size_t> counts(8 * 256, 0);
+    for (uint64_t key : keys) {
+        for (int pass = 0; pass < 8; ++pass) {
+            ++counts[pass * 256 + ((key >> (pass * 8)) & 0xff)];
+        }
+    }
+
+    std::vector<uint64_t> key_buffer(n);
+    std::vector<uint32_t> order_buffer(n);
+    for (int pass = 0; pass < 8; ++pass) {
+        size_t* count = counts.data() + pass * 256;
+        const int shift = pass * 8;
+        if (count[(keys[0] >> shift) & 0xff] == n) {
+            continue;  // 이 바이트는 모두 같음
+        }
+
+        size_t offset = 0;
+        for (int b = 0; b < 256; ++b) {
+            const size_t c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            const size_t pos = count[(keys[i] >> shift) & 0xff]++;
+            key_buffer[pos] = keys[i];
+            order_buffer[pos] = order[i];
+        }
+        keys.swap(key_buffer);
+        order.swap(order_buffer);
+    }
+}
+
+/**
+ * order를 column[order[i]]의 바이트 순서로 안정 정렬합니다 (병렬 병합 정렬)
+ *
+ * 구간마다 std::stable_sort한 뒤 이웃한 구간을 둘씩 std::merge합니다.
+ * 비교는 셀 뷰끼리 하므로 문자열을 복사하지 않습니다.
+ */
+void mergeSort(const CSVTable::Column& column, std::vector<uint32_t>& order, bool descending, size_t threads) {
+    auto less = [&column, descending](uint32_t a, uint32_t b) {
+        return descending ? column[b] < column[a] : column[a] < column[b];
+    };
+
+    const size_t n = order.size();
+    if (threads <= 1) {
+        std::stable_sort(order.begin(), order.end(), less);
+        return;
+    }
+
+    std::vector<size_t> bounds(threads + 1);
+    for (size_t t = 0; t <= threads; ++t) {
+        bounds[t] = n * t / threads;
+    }
+
+    ThreadPool pool(threads);
+    pool.parallelFor(threads, [&](size_t t) {
+        std::stable_sort(order.begin() + bounds[t], order.begin() + bounds[t + 1], less);
+    });
+
+    // 정렬된 구간을 둘씩 합치며 구간 수를 절반으로 줄임 (앞 구간을 먼저 취하므로 안정)
+    std::vector<uint32_t> buffer(n);
+    while (bounds.size() > 2) {
+        const size_t runs = bounds.size() - 1;
+        std::vector<size_t> merged_bounds;
+        for (size_t r = 0; r < runs; r += 2) {
+            merged_bounds.push_back(bounds[r]);
+        }
+        merged_bounds.push_back(n);
+
+        pool.parallelFor((runs + 1) / 2, [&](size_t pair) {
+            const size_t first = bounds[pair * 2];
+            const size_t middle = bounds[std::min(pair * 2 + 1, runs)];
+            const size_t last = bounds[std::min(pair * 2 + 2, runs)];
+            std::merge(order.begin() + first, order.begin() + middle,
+                       order.begin() + middle, order.begin() + last,
+                       buffer.begin() + first, less);
+        });
+        order.swap(buffer);
+        bounds.swap(merged_bounds);
+    }
+}
+
+template <typename T>
+void radixSort(const T* values, std::vector<uint32_t>& order, bool descending) {
+    radixSort([values](uint32_t row) { return orderKey(values[row]); }, order, descending);
+}
+
+// 사전 항목을 바이트 순서로 정렬해 항목별 순위를 구한 뒤, 행은 순위로 기수 정렬합니다
+void dictionarySort(const CSVTable::Column& column, std::vector<uint32_t>& order, bool descending) {
+    std::vector<uint32_t> entries(column.dictionarySize());
+    std::iota(entries.begin(), entries.end(), 0u);
+    std::sort(entries.begin(), entries.end(), [&column](uint32_t a, uint32_t b) {
+        return column.dictionaryValue(a) < column.dictionaryValue(b);
+    });
+
+    std::vector<uint64_t> ranks(entries.size());
+    for (size_t rank = 0; rank < entries.size(); ++rank) {
+        ranks[entries[rank]] = rank;
+    }
+    const uint32_t* codes = column.codes().data();
+    radixSort([&ranks, codes](uint32_t row) { return ranks[codes[row]]; }, order, descending);
+}
+
+} // namespace
+
+std::vector<uint32_t> CSVTable::sortOrder(const std::vector<SortKey>& keys, size_t threads) const {
+    const size_t rows = rowCount();
+    if (rows > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Too many rows to sort");
+    }
+
+    std::vector<const Column*> columns;
+    columns.reserve(keys.size());
+    for (const auto& key : keys) {
+        columns.push_back(&column(key.column));
+    }
+
+    if (threads == 0) {
+        threads = ThreadPool::defaultThreadCount();
+    }
+    threads = std::max<size_t>(1, std::min(threads, rows / kMinRowsPerThread));
+
+    std::vector<uint32_t> order(rows);
+    std::iota(order.begin(), order.end(), 0u);
+    if (rows < 2) {
+        return order;
+    }
+
+    // 안정 정렬을 마지막 키부터 적용하면 앞의 키가 우선하는 다중 키 순서가 됨
+    for (size_t k = keys.size(); k-- > 0;) {
+        const Column& column = *columns[k];
+        const bool descending = keys[k].order == SortOrder::Descending;
+        switch (column.type()) {
+            case ColumnType::Int64:
+                radixSort(column.ints().data(), order, descending);
+                break;
+            case ColumnType::Double:
+                radixSort(column.doubles().data(), order, descending);
+                break;
+            default:
+                if (column.isDictionary()) {
+                    dictionarySort(column, order, descending);
+                } else {
+                    mergeSort(column, order, descending, threads);
+                }
+                break;
+        }
+    }
+    return order;
+}
+
+void CSVTable::sortBy(const std::vector<SortKey>& keys, size_t threads) {
+    const std::vector<uint32_t> order = sortOrder(keys, threads);
+    for (auto& column : columns_) {
+        column.permute(order);
+    }
+}
+
+} // namespace mylib
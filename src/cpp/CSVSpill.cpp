@@ -0,0 +1,627 @@
+#include "cpp/mylib/CSVParser.hpp"
+#include "cpp/mylib/CSVNumber.hpp"
+#include "cpp/mylib/CSVReader.hpp"
+#include "cpp/mylib/CSVWriter.hpp"
+#include "CSVGroupBy.hpp"
+#include "CSVHash.hpp"
+#include "CSVOrderKey.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+namespace mylib {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// memory_budget의 최솟값 (이보다 작으면 묶음이 너무 잘게 나뉨)
+constexpr size_t kMinBudget = 1024 * 1024;
+
+// 묶음 크기 어림: 셀마다 오프셋/길이, 행마다 정렬 작업 공간 (순열 + 기수 정렬 키)
+constexpr size_t kCellOverhead = 16;
+constexpr size_t kRowOverhead = 32;
+
+// 병합할 때 구간 하나가 쓰는 메모리 (미리 읽기 블록 1 MiB × 4 + 행 버퍼)
+constexpr size_t kMergeReaderBytes = 6 * 1024 * 1024;
+constexpr size_t kMaxFanIn = 256;
+
+// groupByFile()이 넘친 부분 집계를 키 해시로 나누는 파일 수 (2의 거듭제곱)
+constexpr size_t kSpillPartitions = 16;
+
+// 묶음에 붙이는 원래 행 번호 열 (사용자 열과 겹치지 않도록 제어 문자로 시작)
+const char* const kRowColumn = "\x1frow";
+
+/**
+ * 임시 디렉터리 안에 만든 작업 디렉터리 (소멸할 때 안의 파일과 함께 지움)
+ */
+class SpillDirectory {
+private:
+    fs::path path_;
+    size_t next_ = 0;
+
+public:
+    explicit SpillDirectory(const std::string& parent) {
+        const fs::path base = parent.empty() ? fs::temp_directory_path() : fs::path(parent);
+        std::random_device device;
+        std::mt19937_64 random(device() ^
+                               static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+        for (int attempt = 0; attempt < 16; ++attempt) {
+            const fs::path candidate = base / ("mylib-spill-" + std::to_string(random()));
+            std::error_code error;
+            if (fs::create_directory(candidate, error)) {
+                path_ = candidate;
+                return;
+            }
+            if (error) {
+                break;
+            }
+        }
+        throw std::runtime_error("Failed to create spill directory in: " + base.string());
+    }
+
+    ~SpillDirectory() {
+        std::error_code error;
+        fs::remove_all(path_, error);
+    }
+
+    SpillDirectory(const SpillDirectory&) = delete;
+    SpillDirectory& operator=(const SpillDirectory&) = delete;
+
+    // 새 임시 파일 경로 (파일은 만들지 않음)
+    std::string newFile() {
+        return (path_ / ("spill-" + std::to_string(next_++) + ".csv")).string();
+    }
+};
+
+uint64_t fileSize(const std::string& path) {
+    std::error_code error;
+    const auto size = fs::file_size(path, error);
+    return error ? 0 : static_cast<uint64_t>(size);
+}
+
+/**
+ * 파일을 메모리 한도만큼씩 테이블로 읽습니다
+ */
+class ChunkReader {
+private:
+    CSVReader reader_;
+    bool pending_;   // reader_.row()에 아직 테이블에 넣지 않은 행이 있음
+    size_t rows_ = 0;
+
+public:
+    ChunkReader(const std::string& filename, const std::vector<std::string>& columns)
+        : reader_(filename, columns)
+        , pending_(reader_.next()) {
+    }
+
+    const std::vector<std::string>& headers() const { return reader_.headers(); }
+    bool done() const { return !pending_; }
+    size_t rows() const { return rows_; }
+
+    // 어림한 크기가 budget에 이를 때까지 행을 읽습니다 (최소 한 행, 남은 행이 없으면 빈 테이블)
+    CSVTable next(size_t budget) {
+        CSVTable table(headers());
+        size_t bytes = 0;
+        while (pending_ && bytes < budget) {
+            const std::vector<std::string_view>& row = reader_.row();
+            table.appendRow(row);
+            bytes += kRowOverhead + row.size() * kCellOverhead;
+            for (std::string_view cell : row) {
+                bytes += cell.size();
+            }
+            ++rows_;
+            pending_ = reader_.next();
+        }
+        return table;
+    }
+};
+
+// 테이블이 차지하는 메모리를 어림합니다
+size_t tableBytes(const CSVTable& table) {
+    size_t bytes = table.rowCount() * kRowOverhead;
+    for (size_t col = 0; col < table.colCount(); ++col) {
+        const CSVTable::Column& column = table.column(col);
+        for (uint32_t length : column.lengths()) {
+            bytes += length + kCellOverhead;
+        }
+        bytes += column.codes().size() * sizeof(uint32_t);
+        bytes += (column.ints().size() + column.doubles().size()) * 8;
+    }
+    return bytes;
+}
+
+void writeFile(const std::string& path, const CSVTable& table, const WriteOptions& options = WriteOptions()) {
+    CSVWriter writer(path, options);
+    writer.writeTable(table);
+    writer.close();
+}
+
+size_t findHeader(const std::vector<std::string>& headers, const std::string& name) {
+    auto it = std::find(headers.begin(), headers.end(), name);
+    if (it == headers.end()) {
+        throw std::runtime_error("Header not found: " + name);
+    }
+    return static_cast<size_t>(it - headers.begin());
+}
+
+// ===== 외부 정렬 =====
+
+// 정렬 키 하나 (열 위치, 비교 타입, 방향)
+struct MergeKey {
+    size_t column;
+    ColumnType type;
+    bool descending;
+};
+
+// 숫자 키 열을 문자열 열로 되돌립니다 (텍스트는 그대로이므로 구간과 결과에 입력의 원래 텍스트를 씀)
+void keepKeyText(CSVTable& table, const std::vector<MergeKey>& keys) {
+    for (const MergeKey& key : keys) {
+        table.column(key.column).convert(ColumnType::String);
+    }
+}
+
+/**
+ * 이미 쓴 정렬 구간을 바뀐 키 타입으로 다시 정렬해 새 파일에 씁니다
+ *
+ * 구간은 묶음 하나이므로 메모리 한도 안에 들어갑니다. 키가 같은 행은 이전 정렬에서도 같았으므로
+ * 구간 안의 원래 순서가 유지됩니다 (안정 정렬).
+ */
+std::string resortRun(SpillDirectory& spill, const std::string& run, const std::vector<SortKey>& keys,
+                      const std::vector<MergeKey>& merge_keys, size_t threads, uint64_t& bytes) {
+    const std::string path = spill.newFile();
+    {
+        ChunkReader reader(run, {});
+        CSVTable table = reader.next(static_cast<size_t>(-1));
+        for (const MergeKey& key : merge_keys) {
+            table.column(key.column).convert(key.type);
+        }
+        table.sortBy(keys, threads);
+        keepKeyText(table, merge_keys);
+        writeFile(path, table);
+    }
+    std::error_code error;
+    fs::remove(run, error);
+    bytes += fileSize(path);
+    return path;
+}
+
+/**
+ * 정렬된 구간 파일들을 k-way 병합해 output에 씁니다
+ *
+ * 구간마다 현재 행과 숫자 키의 순서 키를 두고, 힙에서 가장 앞선 구간의 행을 씁니다.
+ * 키가 같으면 앞 구간을 먼저 내므로 구간이 파일 순서이면 안정 정렬이 유지됩니다.
+ */
+void mergeRuns(const std::vector<std::string>& runs, const std::string& output, const std::vector<MergeKey>& keys) {
+    struct Run {
+        std::unique_ptr<CSVReader> reader;
+        std::vector<uint64_t> numbers;   // 숫자 키의 순서 키 (방향 적용)
+    };
+
+    std::vector<Run> cursors(runs.size());
+    auto advance = [&](Run& run) {
+        if (!run.reader->next()) {
+            return false;
+        }
+        const std::vector<std::string_view>& row = run.reader->row();
+        for (size_t k = 0; k < keys.size(); ++k) {
+            const MergeKey& key = keys[k];
+            if (key.type == ColumnType::String) {
+                continue;
+            }
+            const std::string_view text = row[key.column];
+            uint64_t order = 0;
+            if (key.type == ColumnType::Int64) {
+                int64_t value = 0;
+                parseInt64(text, value);
+                order = detail::orderKey(value);
+            } else {
+                double value = 0.0;
+                parseDouble(text, value);
+                order = detail::orderKey(value);
+            }
+            run.numbers[k] = key.descending ? ~order : order;
+        }
+        return true;
+    };
+
+    // a 구간의 현재 행이 b보다 먼저 나와야 하면 true
+    auto before = [&](size_t a, size_t b) {
+        const std::vector<std::string_view>& row_a = cursors[a].reader->row();
+        const std::vector<std::string_view>& row_b = cursors[b].reader->row();
+        for (size_t k = 0; k < keys.size(); ++k) {
+            if (keys[k].type != ColumnType::String) {
+                if (cursors[a].numbers[k] != cursors[b].numbers[k]) {
+                    return cursors[a].numbers[k] < cursors[b].numbers[k];
+                }
+                continue;
+            }
+            const int compared = row_a[keys[k].column].compare(row_b[keys[k].column]);
+            if (compared != 0) {
+                return keys[k].descending ? compared > 0 : compared < 0;
+            }
+        }
+        return a < b;
+    };
+    auto later = [&](size_t a, size_t b) { return before(b, a); };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heap(later);
+
+    for (size_t i = 0; i < runs.size(); ++i) {
+        cursors[i].reader = std::make_unique<CSVReader>(runs[i]);
+        cursors[i].numbers.resize(keys.size());
+        if (advance(cursors[i])) {
+            heap.push(i);
+        }
+    }
+
+    CSVWriter writer(output);
+    writer.writeRow(cursors.front().reader->headers());
+    while (!heap.empty()) {
+        const size_t top = heap.top();
+        heap.pop();
+        writer.writeRow(cursors[top].reader->row());
+        if (advance(cursors[top])) {
+            heap.push(top);
+        }
+    }
+    writer.close();
+}
+
+// ===== 외부 GROUP BY =====
+
+// 요청한 집계 하나를 부분 집계 열에서 만드는 방법
+struct FinalAggregate {
+    AggregateOp op;
+    size_t first;    // 부분 집계 열 (Mean이면 합계)
+    size_t second;   // Mean의 개수 열
+};
+
+// 숫자가 아닌 열을 Int64로, 안 되면 Double로 변환합니다
+void makeNumeric(CSVTable::Column& column, const std::string& name) {
+    if (column.type() == ColumnType::String &&
+        !column.convert(ColumnType::Int64) && !column.convert(ColumnType::Double)) {
+        throw std::runtime_error("Column is not numeric: " + name);
+    }
+}
+
+// 열은 그대로 두고 헤더만 바꾼 테이블을 만듭니다
+CSVTable renamed(CSVTable&& table, const std::vector<std::string>& headers) {
+    std::vector<CSVTable::Column> columns;
+    columns.reserve(table.colCount());
+    for (size_t col = 0; col < table.colCount(); ++col) {
+        columns.push_back(std::move(table.column(col)));
+    }
+    return CSVTable(headers, std::move(columns));
+}
+
+/**
+ * 부분 집계 테이블 (키 열들 + 부분 집계 열들 + 처음 나온 행 번호)
+ *
+ * 같은 키의 부분 집계는 합계/최솟값/최댓값을 다시 적용하고 개수는 더해서 합칩니다.
+ */
+class PartialTable {
+private:
+    std::vector<std::string> keys_;
+    std::vector<std::string> headers_;
+    std::vector<GroupAggregate> combine_;
+    CSVTable table_;
+
+public:
+    PartialTable(const std::vector<std::string>& keys, const std::vector<GroupAggregate>& partials)
+        : keys_(keys)
+        , headers_(keys) {
+        for (size_t i = 0; i < partials.size(); ++i) {
+            headers_.push_back("p" + std::to_string(i));
+            const AggregateOp op = (partials[i].op == AggregateOp::Count) ? AggregateOp::Sum : partials[i].op;
+            combine_.push_back(GroupAggregate{headers_.back(), op});
+        }
+        headers_.push_back(kRowColumn);
+        combine_.push_back(GroupAggregate{kRowColumn, AggregateOp::Min});
+        table_ = CSVTable(headers_);
+    }
+
+    const std::vector<std::string>& headers() const { return headers_; }
+    CSVTable& table() { return table_; }
+
+    // groupBy() 결과나 파일에서 읽은 부분 집계를 뒤에 붙입니다
+    void append(CSVTable&& partial) {
+        if (table_.rowCount() == 0) {
+            table_ = renamed(std::move(partial), headers_);
+        } else {
+            table_.appendTable(std::move(partial));
+        }
+        // 묶음마다 타입이 달랐던 열(Int64와 Double)은 문자열로 합쳐지므로 다시 변환
+        for (size_t col = keys_.size(); col < headers_.size(); ++col) {
+            makeNumeric(table_.column(col), headers_[col]);
+        }
+    }
+
+    // 같은 키의 부분 집계를 합칩니다
+    void combine(size_t threads) {
+        table_ = renamed(table_.groupBy(keys_, combine_, threads), headers_);
+    }
+
+    CSVTable take() {
+        CSVTable result = std::move(table_);
+        table_ = CSVTable(headers_);
+        return result;
+    }
+};
+
+/**
+ * 부분 집계를 키 해시로 나눈 임시 파일들 (같은 키는 항상 같은 파일)
+ */
+class SpillPartitions {
+private:
+    std::vector<std::string> paths_;
+    std::vector<std::unique_ptr<CSVWriter>> writers_;
+    size_t key_count_;
+
+public:
+    SpillPartitions(SpillDirectory& directory, const std::vector<std::string>& headers, size_t key_count,
+                    size_t budget)
+        : key_count_(key_count) {
+        WriteOptions options;
+        options.buffer_size = std::clamp<size_t>(budget / (4 * kSpillPartitions), 64 * 1024, 1024 * 1024);
+        for (size_t i = 0; i < kSpillPartitions; ++i) {
+            paths_.push_back(directory.newFile());
+            writers_.push_back(std::make_unique<CSVWriter>(paths_.back(), options));
+            writers_.back()->writeRow(headers);
+        }
+    }
+
+    void write(const CSVTable& table) {
+        std::vector<std::string_view> row(table.colCount());
+        for (size_t r = 0; r < table.rowCount(); ++r) {
+            uint64_t h = 0;
+            for (size_t col = 0; col < table.colCount(); ++col) {
+                row[col] = table.column(col)[r];
+                if (col < key_count_) {
+                    h = detail::mix(h + detail::hashBytes(row[col]) + 0x9e3779b97f4a7c15ULL);
+                }
+            }
+            writers_[h & (kSpillPartitions - 1)]->writeRow(row);
+        }
+    }
+
+    // 모두 닫고 파일 경로와 쓴 바이트 수를 반환합니다
+    const std::vector<std::string>& close(uint64_t& bytes) {
+        for (size_t i = 0; i < writers_.size(); ++i) {
+            writers_[i]->close();
+            bytes += fileSize(paths_[i]);
+        }
+        writers_.clear();
+        return paths_;
+    }
+};
+
+} // namespace
+
+SpillStats CSVParser::sortFile(const std::string& input, const std::string& output,
+                               const std::vector<SortKey>& keys, const SpillOptions& options) {
+    const size_t budget = std::max(kMinBudget, options.memory_budget);
+    ChunkReader source(input, {});
+
+    std::vector<MergeKey> merge_keys;
+    merge_keys.reserve(keys.size());
+    for (const auto& key : keys) {
+        merge_keys.push_back(MergeKey{findHeader(source.headers(), key.column), ColumnType::String,
+                                      key.order == SortOrder::Descending});
+    }
+
+    SpillStats stats;
+    std::unique_ptr<SpillDirectory> spill;
+    std::vector<std::string> runs;
+    do {
+        CSVTable chunk = source.next(budget);
+        ++stats.chunks;
+
+        // 키 타입은 메모리 안 infer()처럼 파일 전체로 정함: 첫 묶음에서 추론하고, 나중 묶음의
+        // 정수 키에 실수가 섞이면 Double로 넓히고 (정수의 순서는 실수로 비교해도 같으므로 쓴 구간은 그대로),
+        // 숫자가 아닌 값이 나오면 문자열 키로 바꾸고 이미 쓴 구간을 다시 정렬
+        bool resort = false;
+        for (MergeKey& key : merge_keys) {
+            CSVTable::Column& column = chunk.column(key.column);
+            if (stats.chunks == 1) {
+                key.type = options.infer_types ? column.infer(0) : ColumnType::String;
+            } else if (key.type != ColumnType::String && !column.convert(key.type)) {
+                if (key.type == ColumnType::Int64 && column.convert(ColumnType::Double)) {
+                    key.type = ColumnType::Double;
+                } else {
+                    key.type = ColumnType::String;
+                    resort = true;
+                }
+            }
+        }
+        if (resort) {
+            for (std::string& run : runs) {
+                run = resortRun(*spill, run, keys, merge_keys, options.threads, stats.spilled_bytes);
+            }
+        }
+        chunk.sortBy(keys, options.threads);
+        keepKeyText(chunk, merge_keys);
+
+        if (stats.chunks == 1 && source.done()) {
+            writeFile(output, chunk);   // 한 묶음에 들어감: 디스크를 더 쓰지 않음
+            stats.rows = source.rows();
+            return stats;
+        }
+        if (!spill) {
+            spill = std::make_unique<SpillDirectory>(options.temp_dir);
+        }
+        runs.push_back(spill->newFile());
+        writeFile(runs.back(), chunk);
+        stats.spilled_bytes += fileSize(runs.back());
+    } while (!source.done());
+    stats.rows = source.rows();
+
+    // 구간이 한 번에 병합할 수보다 많으면 이웃한 구간끼리 먼저 병합 (순서를 유지해 안정 정렬)
+    const size_t fan_in = std::clamp<size_t>(budget / kMergeReaderBytes, 2, kMaxFanIn);
+    while (runs.size() > fan_in) {
+        std::vector<std::string> merged;
+        for (size_t first = 0; first < runs.size(); first += fan_in) {
+            const size_t last = std::min(runs.size(), first + fan_in);
+            if (last - first == 1) {
+                merged.push_back(runs[first]);
+                continue;
+            }
+            const std::vector<std::string> group(runs.begin() + first, runs.begin() + last);
+            merged.push_back(spill->newFile());
+            mergeRuns(group, merged.back(), merge_keys);
+            stats.spilled_bytes += fileSize(merged.back());
+            for (const auto& path : group) {
+                std::error_code error;
+                fs::remove(path, error);
+            }
+        }
+        runs.swap(merged);
+        ++stats.merge_passes;
+    }
+    mergeRuns(runs, output, merge_keys);
+    ++stats.merge_passes;
+    return stats;
+}
+
+CSVTable CSVParser::groupByFile(const std::string& input, const std::vector<std::string>& keys,
+                                const std::vector<GroupAggregate>& aggregates, const SpillOptions& options,
+                                SpillStats* stats_out) {
+    if (keys.empty()) {
+        throw std::invalid_argument("groupBy needs at least one key column");
+    }
+    const size_t budget = std::max(kMinBudget, options.memory_budget);
+
+    // 키와 집계 열만 읽음
+    std::vector<std::string> columns(keys);
+    std::vector<std::string> numeric_columns;
+    for (const auto& aggregate : aggregates) {
+        if (std::find(columns.begin(), columns.end(), aggregate.column) == columns.end()) {
+            columns.push_back(aggregate.column);
+        }
+        if (aggregate.op != AggregateOp::Count &&
+            std::find(numeric_columns.begin(), numeric_columns.end(), aggregate.column) == numeric_columns.end()) {
+            numeric_columns.push_back(aggregate.column);
+        }
+    }
+    ChunkReader source(input, columns);
+
+    // 요청한 집계를 합칠 수 있는 부분 집계로 바꿈 (Mean = 합계 + 개수)
+    std::vector<GroupAggregate> partials;
+    std::vector<FinalAggregate> finals;
+    for (const auto& aggregate : aggregates) {
+        FinalAggregate final{aggregate.op, partials.size(), 0};
+        if (aggregate.op == AggregateOp::Mean) {
+            partials.push_back(GroupAggregate{aggregate.column, AggregateOp::Sum});
+            final.second = partials.size();
+            partials.push_back(GroupAggregate{aggregate.column, AggregateOp::Count});
+        } else {
+            partials.push_back(aggregate);
+        }
+        finals.push_back(final);
+    }
+    std::vector<GroupAggregate> chunk_aggregates(partials);
+    chunk_aggregates.push_back(GroupAggregate{kRowColumn, AggregateOp::Min});
+
+    SpillStats stats;
+    PartialTable pending(keys, partials);
+    std::unique_ptr<SpillDirectory> spill;
+    std::unique_ptr<SpillPartitions> partitions;
+    do {
+        CSVTable chunk = source.next(budget);
+        ++stats.chunks;
+        for (const auto& name : numeric_columns) {
+            makeNumeric(chunk.column(chunk.findColumn(name)), name);
+        }
+
+        // 그룹이 처음 나온 행을 알 수 있도록 원래 행 번호 열을 붙여 부분 집계
+        CSVTable::Column row_numbers;
+        const size_t base = source.rows() - chunk.rowCount();
+        for (size_t row = 0; row < chunk.rowCount(); ++row) {
+            row_numbers.appendInt(static_cast<int64_t>(base + row));
+        }
+        std::vector<std::string> headers = chunk.headers();
+        headers.push_back(kRowColumn);
+        std::vector<CSVTable::Column> chunk_columns;
+        for (size_t col = 0; col < chunk.colCount(); ++col) {
+            chunk_columns.push_back(std::move(chunk.column(col)));
+        }
+        chunk_columns.push_back(std::move(row_numbers));
+        const CSVTable numbered(std::move(headers), std::move(chunk_columns));
+        pending.append(numbered.groupBy(keys, chunk_aggregates, options.threads));
+
+        if (tableBytes(pending.table()) > budget / 2) {
+            pending.combine(options.threads);
+            if (tableBytes(pending.table()) > budget / 2) {
+                if (!partitions) {
+                    spill = std::make_unique<SpillDirectory>(options.temp_dir);
+                    partitions = std::make_unique<SpillPartitions>(*spill, pending.headers(), keys.size(), budget);
+                }
+                partitions->write(pending.take());
+            }
+        }
+    } while (!source.done());
+    stats.rows = source.rows();
+
+    CSVTable combined;
+    if (!partitions) {
+        pending.combine(options.threads);
+        combined = pending.take();
+    } else {
+        // 남은 부분 집계도 내보내고, 파일마다 읽어 합침 (같은 키는 한 파일에만 있음)
+        partitions->write(pending.take());
+        const std::vector<std::string> paths = partitions->close(stats.spilled_bytes);
+        combined = CSVTable(pending.headers());
+        for (const auto& path : paths) {
+            CSVReader reader(path);
+            PartialTable part(keys, partials);
+            CSVTable loaded(pending.headers());
+            for (const auto& row : reader) {
+                loaded.appendRow(row);
+            }
+            part.append(std::move(loaded));
+            part.combine(options.threads);
+            combined.appendTable(part.take());
+        }
+    }
+    // 파일마다 타입이 달랐던 부분 집계 열을 다시 숫자로, 처음 나온 행 순서로 정렬 (메모리 안 groupBy()와 같은 순서)
+    for (size_t col = keys.size(); col < combined.colCount(); ++col) {
+        makeNumeric(combined.column(col), pending.headers()[col]);
+    }
+    combined.sortBy({SortKey{kRowColumn}}, options.threads);
+
+    const size_t groups = combined.rowCount();
+    std::vector<std::string> headers(keys);
+    std::vector<CSVTable::Column> out;
+    for (size_t k = 0; k < keys.size(); ++k) {
+        out.push_back(std::move(combined.column(k)));
+        if (options.infer_types) {
+            out.back().infer(0);
+        }
+    }
+    for (size_t i = 0; i < aggregates.size(); ++i) {
+        headers.push_back(detail::aggregateName(aggregates[i]));
+        const CSVTable::Column& first = combined.column(keys.size() + finals[i].first);
+        if (finals[i].op != AggregateOp::Mean) {
+            out.push_back(first);
+            continue;
+        }
+        const CSVTable::Column& counts = combined.column(keys.size() + finals[i].second);
+        CSVTable::Column means;
+        for (size_t row = 0; row < groups; ++row) {
+            const double sum = (first.type() == ColumnType::Int64) ? static_cast<double>(first.ints()[row])
+                                                                   : first.doubles()[row];
+            means.appendDouble(sum / static_cast<double>(counts.ints()[row]));
+        }
+        out.push_back(std::move(means));
+    }
+    if (stats_out != nullptr) {
+        *stats_out = stats;
+    }
+    return CSVTable(std::move(headers), std::move(out));
+}
+
+} // namespace mylib
@@ -0,0 +1,768 @@
+#include "cpp/mylib/CSVTable.hpp"
+#include "cpp/mylib/CSVNumber.hpp"
+#include "mylib/reduce.h"
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <unordered_map>
+
+namespace mylib {
+
+namespace {
+
+// 전체 문자열이 하나의 숫자일 때만 성공으로 봅니다
+bool parseNumber(std::string_view text, int64_t& value) {
+    return parseInt64(text, value);
+}
+
+bool parseNumber(std::string_view text, double& value) {
+    return parseDouble(text, value);
+}
+
+template <typename T>
+bool convertValues(const CSVTable::Column& column, ColumnBuffer<T>& out) {
+    std::vector<T> values(column.size());
+    if (column.isDictionary()) {
+        // 사전 항목만 한 번씩 변환하고 행은 코드로 채움
+        std::vector<T> entries(column.dictionarySize());
+        for (size_t code = 0; code < entries.size(); ++code) {
+            if (!parseNumber(column.dictionaryValue(static_cast<uint32_t>(code)), entries[code])) {
+                return false;
+            }
+        }
+        const uint32_t* codes = column.codes().data();
+        for (size_t row = 0; row < values.size(); ++row) {
+            values[row] = entries[codes[row]];
+        }
+    } else {
+        for (size_t row = 0; row < column.size(); ++row) {
+            if (!parseNumber(column[row], values[row])) {
+                return false;
+            }
+        }
+    }
+    out.owned() = std::move(values);
+    return true;
+}
+
+template <typename T>
+void appendValues(ColumnBuffer<T>& dst, const ColumnBuffer<T>& src) {
+    dst.owned().insert(dst.owned().end(), src.begin(), src.end());
+}
+
+// 열 타입 이름 (오류 메시지용)
+const char* typeName(ColumnType type) {
+    switch (type) {
+        case ColumnType::Int64:
+            return "Int64";
+        case ColumnType::Double:
+            return "Double";
+        default:
+            return "String";
+    }
+}
+
+} // namespace
+
+// ====================================
+// Column
+// ====================================
+
+CSVTable::Column::Column(const char* borrowed)
+    : borrowed_(borrowed)
+    , dictionary_(false)
+    , type_(ColumnType::String)
+    , heap_limit_(UINT64_MAX) {
+}
+
+void CSVTable::Column::corruptCell() {
+    throw std::runtime_error("Cell is outside the borrowed buffer (corrupt snapshot)");
+}
+
+void CSVTable::Column::append(std::string_view value) {
+    if (value.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("CSV cell too large");
+    }
+    if (dictionary_) {
+        decodeDictionary();
+    }
+
+    std::vector<uint64_t>& offsets = offsets_.owned();
+    if (value.empty()) {
+        // 빈 셀은 버퍼를 가리키지 않을 수도 있으므로 오프셋만 기록
+        offsets.push_back(0);
+    } else if (borrowed_ != nullptr) {
+        offsets.push_back(static_cast<uint64_t>(value.data() - borrowed_));
+    } else {
+        offsets.push_back(heap_.size());
+        heap_.insert(heap_.end(), value.begin(), value.end());
+    }
+    lengths_.owned().push_back(static_cast<uint32_t>(value.size()));
+
+    // 문자열이 바뀌었으므로 타입 배열은 더 이상 맞지 않음
+    if (type_ != ColumnType::String) {
+        convert(ColumnType::String);
+    }
+}
+
+namespace {
+
+template <typename T>
+std::string_view formatNumber(char (&text)[32], T value) {
+    char* end = std::to_chars(text, text + sizeof(text), value).ptr;
+    return std::string_view(text, static_cast<size_t>(end - text));
+}
+
+} // namespace
+
+void CSVTable::Column::appendInt(int64_t value) {
+    if (borrowed_ != nullptr) {
+        materialize();
+    }
+    char text[32];
+    const std::string_view formatted = formatNumber(text, value);
+    if (size() > 0 && type_ != ColumnType::Int64) {
+        append(formatted);
+        return;
+    }
+
+    type_ = ColumnType::String;  // append()가 타입 배열을 지우지 않도록
+    append(formatted);
+    ints_.owned().push_back(value);
+    type_ = ColumnType::Int64;
+}
+
+void CSVTable::Column::appendDouble(double value) {
+    if (borrowed_ != nullptr) {
+        materialize();
+    }
+    char text[32];
+    const std::string_view formatted = formatNumber(text, value);
+    if (size() > 0 && type_ != ColumnType::Double) {
+        append(formatted);
+        return;
+    }
+
+    type_ = ColumnType::String;  // append()가 타입 배열을 지우지 않도록
+    append(formatted);
+    doubles_.owned().push_back(value);
+    type_ = ColumnType::Double;
+}
+
+void CSVTable::Column::borrowArrays(const char* heap, const uint64_t* offsets, const uint32_t* lengths,
+                                    size_t rows, ColumnType type, const void* values, uint64_t heap_size) {
+    heap_.clear();
+    heap_.shrink_to_fit();
+    borrowed_ = heap;
+    heap_limit_ = heap_size;
+    offsets_.borrow(offsets, rows);
+    lengths_.borrow(lengths, rows);
+    codes_.borrow(nullptr, 0);
+    dictionary_ = false;
+
+    type_ = ColumnType::String;
+    ints_.borrow(nullptr, 0);
+    doubles_.borrow(nullptr, 0);
+    if (type == ColumnType::Int64 && values != nullptr) {
+        ints_.borrow(static_cast<const int64_t*>(values), rows);
+        type_ = type;
+    } else if (type == ColumnType::Double && values != nullptr) {
+        doubles_.borrow(static_cast<const double*>(values), rows);
+        type_ = type;
+    }
+}
+
+namespace {
+
+template <typename T>
+void permuteBuffer(ColumnBuffer<T>& buffer, const std::vector<uint32_t>& order) {
+    if (buffer.empty()) {
+        return;
+    }
+    std::vector<T> permuted(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        permuted[i] = buffer[order[i]];
+    }
+    buffer.borrow(nullptr, 0);  // 빌린 배열을 복사하지 않고 바로 교체
+    buffer.owned() = std::move(permuted);
+}
+
+} // namespace
+
+void CSVTable::Column::permute(const std::vector<uint32_t>& order) {
+    if (dictionary_) {
+        permuteBuffer(codes_, order);
+    } else {
+        permuteBuffer(offsets_, order);
+        permuteBuffer(lengths_, order);
+    }
+    permuteBuffer(ints_, order);
+    permuteBuffer(doubles_, order);
+}
+
+namespace {
+
+template <typename T>
+void gatherValues(ColumnBuffer<T>& dst, const ColumnBuffer<T>& src, const std::vector<uint32_t>& rows) {
+    std::vector<T>& values = dst.owned();
+    values.resize(rows.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        values[i] = src[rows[i]];
+    }
+}
+
+} // namespace
+
+CSVTable::Column CSVTable::Column::gather(const std::vector<uint32_t>& rows) const {
+    Column result;
+    const bool missing = std::find(rows.begin(), rows.end(), kMissingRow) != rows.end();
+
+    if (dictionary_) {
+        // 사전(항상 소유)은 그대로 복사하고, 빈 셀이 필요하면 빈 항목을 찾거나 추가
+        result.heap_ = heap_;
+        result.offsets_.owned().assign(offsets_.begin(), offsets_.end());
+        result.lengths_.owned().assign(lengths_.begin(), lengths_.end());
+        uint32_t empty_code = 0;
+        if (missing) {
+            const auto found = std::find(lengths_.begin(), lengths_.end(), 0u);
+            empty_code = static_cast<uint32_t>(found - lengths_.begin());
+            if (found == lengths_.end()) {
+                result.offsets_.owned().push_back(0);
+                result.lengths_.owned().push_back(0);
+            }
+        }
+        std::vector<uint32_t>& codes = result.codes_.owned();
+        codes.resize(rows.size());
+        for (size_t i = 0; i < rows.size(); ++i) {
+            codes[i] = (rows[i] == kMissingRow) ? empty_code : codes_[rows[i]];
+        }
+        result.dictionary_ = true;
+    } else {
+        size_t total = 0;
+        for (uint32_t row : rows) {
+            total += (row == kMissingRow) ? 0 : lengths_[row];
+        }
+        result.heap_.reserve(total);
+        std::vector<uint64_t>& offsets = result.offsets_.owned();
+        std::vector<uint32_t>& lengths = result.lengths_.owned();
+        offsets.resize(rows.size());
+        lengths.resize(rows.size());
+        for (size_t i = 0; i < rows.size(); ++i) {
+            const std::string_view value = (rows[i] == kMissingRow) ? std::string_view() : entry(rows[i]);
+            offsets[i] = result.heap_.size();
+            lengths[i] = static_cast<uint32_t>(value.size());
+            result.heap_.insert(result.heap_.end(), value.begin(), value.end());
+        }
+    }
+
+    if (!missing && type_ == ColumnType::Int64) {
+        gatherValues(result.ints_, ints_, rows);
+        result.type_ = type_;
+    } else if (!missing && type_ == ColumnType::Double) {
+        gatherValues(result.doubles_, doubles_, rows);
+        result.type_ = type_;
+    }
+    return result;
+}
+
+bool CSVTable::Column::encodeDictionary(size_t max_distinct) {
+    if (dictionary_) {
+        return true;
+    }
+    if (type_ != ColumnType::String || max_distinct == 0 || size() > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+
+    // 값 → 항목 번호 (뷰는 아직 바꾸지 않은 기존 셀을 가리킴)
+    std::unordered_map<std::string_view, uint32_t> codes_of;
+    codes_of.reserve(std::min(max_distinct, size()));
+    std::vector<uint32_t> codes(size());
+    std::vector<size_t> first_rows;  // 항목별로 처음 나온 행
+    for (size_t row = 0; row < size(); ++row) {
+        auto inserted = codes_of.emplace((*this)[row], static_cast<uint32_t>(first_rows.size()));
+        if (inserted.second) {
+            if (first_rows.size() == max_distinct) {
+                return false;
+            }
+            first_rows.push_back(row);
+        }
+        codes[row] = inserted.first->second;
+    }
+
+    std::vector<char> heap;
+    std::vector<uint64_t> offsets;
+    std::vector<uint32_t> lengths;
+    offsets.reserve(first_rows.size());
+    lengths.reserve(first_rows.size());
+    for (size_t row : first_rows) {
+        const std::string_view value = (*this)[row];
+        offsets.push_back(heap.size());
+        lengths.push_back(static_cast<uint32_t>(value.size()));
+        heap.insert(heap.end(), value.begin(), value.end());
+    }
+
+    heap_ = std::move(heap);
+    borrowed_ = nullptr;
+    heap_limit_ = UINT64_MAX;
+    offsets_.borrow(nullptr, 0);
+    offsets_.owned() = std::move(offsets);
+    lengths_.borrow(nullptr, 0);
+    lengths_.owned() = std::move(lengths);
+    codes_.borrow(nullptr, 0);
+    codes_.owned() = std::move(codes);
+    dictionary_ = true;
+    return true;
+}
+
+void CSVTable::Column::decodeDictionary() {
+    if (!dictionary_) {
+        return;
+    }
+
+    size_t total = 0;
+    for (uint32_t code : codes_) {
+        total += lengths_[code];
+    }
+
+    std::vector<char> heap;
+    std::vector<uint64_t> offsets(size());
+    std::vector<uint32_t> lengths(size());
+    heap.reserve(total);
+    for (size_t row = 0; row < size(); ++row) {
+        const std::string_view value = (*this)[row];
+        offsets[row] = heap.size();
+        lengths[row] = static_cast<uint32_t>(value.size());
+        heap.insert(heap.end(), value.begin(), value.end());
+    }
+
+    heap_ = std::move(heap);
+    offsets_.owned() = std::move(offsets);
+    lengths_.owned() = std::move(lengths);
+    codes_.borrow(nullptr, 0);
+    dictionary_ = false;
+}
+
+void CSVTable::Column::appendDictionary(const Column& other) {
+    // 기존 항목 뷰가 무효화되지 않도록 heap_을 미리 늘려 둠
+    heap_.reserve(heap_.size() + other.heap_.size());
+
+    std::unordered_map<std::string_view, uint32_t> codes_of;
+    codes_of.reserve(dictionarySize() + other.dictionarySize());
+    for (size_t code = 0; code < dictionarySize(); ++code) {
+        codes_of.emplace(entry(code), static_cast<uint32_t>(code));
+    }
+
+    // other의 항목 번호 → 합친 사전의 항목 번호
+    std::vector<uint32_t> remap(other.dictionarySize());
+    std::vector<uint64_t>& offsets = offsets_.owned();
+    std::vector<uint32_t>& lengths = lengths_.owned();
+    for (size_t code = 0; code < remap.size(); ++code) {
+        const std::string_view value = other.entry(code);
+        auto found = codes_of.find(value);
+        if (found != codes_of.end()) {
+            remap[code] = found->second;
+            continue;
+        }
+        remap[code] = static_cast<uint32_t>(offsets.size());
+        offsets.push_back(heap_.size());
+        lengths.push_back(static_cast<uint32_t>(value.size()));
+        heap_.insert(heap_.end(), value.begin(), value.end());
+        codes_of.emplace(entry(remap[code]), remap[code]);
+    }
+
+    std::vector<uint32_t>& codes = codes_.owned();
+    codes.reserve(codes.size() + other.codes_.size());
+    for (uint32_t code : other.codes_) {
+        codes.push_back(remap[code]);
+    }
+}
+
+void CSVTable::Column::appendColumn(Column&& other) {
+    if (other.dictionary_ && size() == 0) {
+        *this = std::move(other);
+        return;
+    }
+    if (dictionary_ != other.dictionary_) {
+        decodeDictionary();
+        other.decodeDictionary();
+    }
+    if (borrowed_ != nullptr && other.borrowed_ != borrowed_) {
+        materialize();
+    }
+
+    const ColumnType merged_type = (size() == 0 || type_ == other.type_) ? other.type_ : ColumnType::String;
+    type_ = ColumnType::String;  // 아래 append()가 타입 배열을 지우지 않도록 잠시 문자열로 둠
+
+    if (dictionary_) {
+        // 둘 다 사전 열: 사전을 합치고 코드를 옮겨 붙임
+        appendDictionary(other);
+    } else if (borrowed_ == other.borrowed_ && borrowed_ != nullptr) {
+        // 같은 버퍼를 빌린 열: 오프셋을 그대로 이어 붙임
+        appendValues(offsets_, other.offsets_);
+        appendValues(lengths_, other.lengths_);
+    } else if (other.borrowed_ == nullptr) {
+        // 둘 다 소유한 열: 바이트를 이어 붙이고 오프셋을 옮김
+        const uint64_t base = heap_.size();
+        if (heap_.empty() && offsets_.empty() && !other.offsets_.isBorrowed()) {
+            heap_ = std::move(other.heap_);
+            offsets_.owned() = std::move(other.offsets_.owned());
+        } else {
+            heap_.insert(heap_.end(), other.heap_.begin(), other.heap_.end());
+            std::vector<uint64_t>& offsets = offsets_.owned();
+            offsets.reserve(offsets.size() + other.offsets_.size());
+            for (uint64_t offset : other.offsets_) {
+                offsets.push_back(base + offset);
+            }
+        }
+        appendValues(lengths_, other.lengths_);
+    } else {
+        for (size_t row = 0; row < other.size(); ++row) {
+            append(other[row]);
+        }
+    }
+
+    if (merged_type == ColumnType::Int64) {
+        appendValues(ints_, other.ints_);
+    } else if (merged_type == ColumnType::Double) {
+        appendValues(doubles_, other.doubles_);
+    }
+    type_ = merged_type;
+    if (merged_type != ColumnType::Int64) {
+        ints_.borrow(nullptr, 0);
+    }
+    if (merged_type != ColumnType::Double) {
+        doubles_.borrow(nullptr, 0);
+    }
+}
+
+void CSVTable::Column::materialize() {
+    if (borrowed_ != nullptr) {
+        size_t total = 0;
+        for (uint32_t length : lengths_) {
+            total += length;
+        }
+
+        std::vector<char> heap;
+        heap.reserve(static_cast<size_t>(std::min<uint64_t>(total, heap_limit_)));
+        std::vector<uint64_t>& offsets = offsets_.owned();
+        for (size_t row = 0; row < offsets.size(); ++row) {
+            const std::string_view cell = entry(row);
+            offsets[row] = heap.size();
+            heap.insert(heap.end(), cell.begin(), cell.end());
+        }
+
+        heap_ = std::move(heap);
+        borrowed_ = nullptr;
+        heap_limit_ = UINT64_MAX;
+    }
+
+    offsets_.owned();
+    lengths_.owned();
+    codes_.owned();
+    ints_.owned();
+    doubles_.owned();
+}
+
+bool CSVTable::Column::convert(ColumnType type) {
+    if (type == type_) {
+        return true;
+    }
+
+    switch (type) {
+        case ColumnType::String:
+            ints_.borrow(nullptr, 0);
+            doubles_.borrow(nullptr, 0);
+            break;
+        case ColumnType::Int64:
+            if (!convertValues(*this, ints_)) {
+                return false;
+            }
+            doubles_.borrow(nullptr, 0);
+            break;
+        case ColumnType::Double:
+            if (!convertValues(*this, doubles_)) {
+                return false;
+            }
+            ints_.borrow(nullptr, 0);
+            break;
+    }
+    type_ = type;
+    return true;
+}
+
+ColumnType CSVTable::Column::infer(size_t sample_rows) {
+    const size_t sample = (sample_rows == 0) ? size() : std::min(sample_rows, size());
+    if (sample == 0) {
+        return type_;
+    }
+
+    ColumnType guess = ColumnType::Int64;
+    for (size_t row = 0; row < sample && guess != ColumnType::String; ++row) {
+        int64_t int_value;
+        double double_value;
+        if (guess == ColumnType::Int64 && parseNumber((*this)[row], int_value)) {
+            continue;
+        }
+        guess = parseNumber((*this)[row], double_value) ? ColumnType::Double : ColumnType::String;
+    }
+
+    // 표본 밖에서 실패하면 Int64 → Double → String 순으로 넓힘
+    if (guess == ColumnType::Int64 && convert(ColumnType::Int64)) {
+        return type_;
+    }
+    if (guess != ColumnType::String && convert(ColumnType::Double)) {
+        return type_;
+    }
+    convert(ColumnType::String);
+    return type_;
+}
+
+std::string_view CSVTable::Column::at(size_t row) const {
+    if (row >= size()) {
+        throw std::out_of_range("Row index out of range");
+    }
+    return (*this)[row];
+}
+
+// ====================================
+// CSVTable
+// ====================================
+
+CSVTable::CSVTable(std::vector<std::string> headers, const char* borrowed)
+    : headers_(std::move(headers))
+    , columns_(headers_.size(), Column(borrowed)) {
+}
+
+CSVTable::CSVTable(std::vector<std::string> headers, std::vector<Column> columns)
+    : headers_(std::move(headers))
+    , columns_(std::move(columns)) {
+    if (headers_.size() != columns_.size()) {
+        throw std::invalid_argument("Column count mismatch");
+    }
+    for (const auto& column : columns_) {
+        if (column.size() != columns_[0].size()) {
+            throw std::invalid_argument("Column length mismatch");
+        }
+    }
+}
+
+void CSVTable::appendRow(const std::vector<std::string_view>& row) {
+    for (size_t col = 0; col < columns_.size(); ++col) {
+        columns_[col].append(col < row.size() ? row[col] : std::string_view());
+    }
+}
+
+void CSVTable::appendTable(CSVTable&& other) {
+    if (other.columns_.size() != columns_.size()) {
+        throw std::invalid_argument("Column count mismatch");
+    }
+    for (size_t col = 0; col < columns_.size(); ++col) {
+        columns_[col].appendColumn(std::move(other.columns_[col]));
+    }
+}
+
+void CSVTable::materialize() {
+    for (auto& column : columns_) {
+        column.materialize();
+    }
+}
+
+bool CSVTable::convertColumn(size_t col, ColumnType type) {
+    return column(col).convert(type);
+}
+
+void CSVTable::inferTypes(size_t sample_rows) {
+    for (auto& column : columns_) {
+        column.infer(sample_rows);
+    }
+}
+
+size_t CSVTable::encodeDictionaries(size_t max_distinct) {
+    size_t encoded = 0;
+    for (auto& column : columns_) {
+        if (column.encodeDictionary(max_distinct)) {
+            ++encoded;
+        }
+    }
+    return encoded;
+}
+
+std::vector<uint32_t> CSVTable::select(const std::vector<CSVPredicate>& predicates) const {
+    const size_t rows = rowCount();
+    if (rows > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Too many rows to select");
+    }
+
+    // 조건마다 열을 찾고, 사전 열이면 항목별 결과를 미리 구함
+    std::vector<const Column*> columns;
+    std::vector<std::vector<char>> entry_matches(predicates.size());
+    columns.reserve(predicates.size());
+    for (size_t i = 0; i < predicates.size(); ++i) {
+        const Column& column = this->column(predicates[i].column());
+        columns.push_back(&column);
+        if (column.isDictionary()) {
+            entry_matches[i].resize(column.dictionarySize());
+            for (size_t code = 0; code < column.dictionarySize(); ++code) {
+                entry_matches[i][code] = predicates[i].matches(column.dictionaryValue(static_cast<uint32_t>(code)));
+            }
+        }
+    }
+
+    std::vector<uint32_t> selected;
+    for (size_t row = 0; row < rows; ++row) {
+        bool keep = true;
+        for (size_t i = 0; i < predicates.size() && keep; ++i) {
+            const Column& column = *columns[i];
+            keep = column.isDictionary() ? entry_matches[i][column.codes()[row]] != 0
+                                         : predicates[i].matches(column[row]);
+        }
+        if (keep) {
+            selected.push_back(static_cast<uint32_t>(row));
+        }
+    }
+    return selected;
+}
+
+int64_t CSVTable::getInt(size_t row, size_t col) const {
+    get(row, col);  // 범위 검사
+    const Column& column = columns_[col];
+    if (column.type() != ColumnType::Int64) {
+        throw std::runtime_error("Column is not Int64: " + headers_[col]);
+    }
+    return column.ints()[row];
+}
+
+double CSVTable::getDouble(size_t row, size_t col) const {
+    get(row, col);  // 범위 검사
+    const Column& column = columns_[col];
+    if (column.type() == ColumnType::Double) {
+        return column.doubles()[row];
+    }
+    if (column.type() == ColumnType::Int64) {
+        return static_cast<double>(column.ints()[row]);
+    }
+    throw std::runtime_error("Column is not numeric: " + headers_[col]);
+}
+
+template <>
+const ColumnBuffer<int64_t>& CSVTable::column<int64_t>(const std::string& header_name) const {
+    const Column& column = this->column(header_name);
+    if (column.type() != ColumnType::Int64) {
+        throw std::runtime_error("Column " + header_name + " is " + typeName(column.type()) + ", not Int64");
+    }
+    return column.ints();
+}
+
+template <>
+const ColumnBuffer<double>& CSVTable::column<double>(const std::string& header_name) const {
+    const Column& column = this->column(header_name);
+    if (column.type() != ColumnType::Double) {
+        throw std::runtime_error("Column " + header_name + " is " + typeName(column.type()) + ", not Double");
+    }
+    return column.doubles();
+}
+
+std::vector<double> CSVTable::aggregate(const std::string& header_name,
+                                        const std::vector<AggregateOp>& ops) const {
+    const Column& column = this->column(header_name);
+
+    // 한 번 훑어 합계/최솟값/최댓값을 함께 구함
+    double sum;
+    double min;
+    double max;
+    size_t count;
+    if (column.type() == ColumnType::Int64) {
+        ReduceInt64 stats;
+        reduce_int64(column.ints().data(), column.ints().size(), &stats);
+        sum = static_cast<double>(stats.sum);
+        min = static_cast<double>(stats.min);
+        max = static_cast<double>(stats.max);
+        count = stats.count;
+    } else if (column.type() == ColumnType::Double) {
+        ReduceDouble stats;
+        reduce_double(column.doubles().data(), column.doubles().size(), &stats);
+        sum = stats.sum;
+        min = stats.min;
+        max = stats.max;
+        count = stats.count;
+    } else {
+        throw std::runtime_error("Column is not numeric: " + header_name);
+    }
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> result;
+    result.reserve(ops.size());
+    for (AggregateOp op : ops) {
+        switch (op) {
+            case AggregateOp::Sum:
+                result.push_back(sum);
+                break;
+            case AggregateOp::Min:
+                result.push_back(count > 0 ? min : nan);
+                break;
+            case AggregateOp::Max:
+                result.push_back(count > 0 ? max : nan);
+                break;
+            case AggregateOp::Mean:
+                result.push_back(count > 0 ? sum / static_cast<double>(count) : nan);
+                break;
+            case AggregateOp::Count:
+                result.push_back(static_cast<double>(count));
+                break;
+        }
+    }
+    return result;
+}
+
+size_t CSVTable::findColumn(const std::string& header_name) const {
+    auto it = std::find(headers_.begin(), headers_.end(), header_name);
+    if (it == headers_.end()) {
+        throw std::runtime_error("Header not found: " + header_name);
+    }
+    return std::distance(headers_.begin(), it);
+}
+
+const CSVTable::Column& CSVTable::column(size_t col) const {
+    if (col >= columns_.size()) {
+        throw std::out_of_range("Column index out of range");
+    }
+    return columns_[col];
+}
+
+CSVTable::Column& CSVTable::column(size_t col) {
+    if (col >= columns_.size()) {
+        throw std::out_of_range("Column index out of range");
+    }
+    return columns_[col];
+}
+
+const CSVTable::Column& CSVTable::column(const std::string& header_name) const {
+    return columns_[findColumn(header_name)];
+}
+
+std::string_view CSVTable::get(size_t row, size_t col) const {
+    if (row >= rowCount()) {
+        throw std::out_of_range("Row index out of range");
+    }
+    if (col >= columns_.size()) {
+        throw std::out_of_range("Column index out of range");
+    }
+    return columns_[col][row];
+}
+
+size_t CSVTable::rowCount() const {
+    return columns_.empty() ? 0 : columns_[0].size();
+}
+
+size_t CSVTable::colCount() const {
+    return columns_.size();
+}
+
+const std::vector<std::string>& CSVTable::headers() const {
+    return headers_;
+}
+
+} // namespace mylib
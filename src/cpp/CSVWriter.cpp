@@ -0,0 +1,176 @@
+#include "cpp/mylib/CSVWriter.hpp"
+#include "cpp/mylib/ThreadPool.hpp"
+#include "mylib/csv_tokenizer.h"
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+namespace mylib {
+
+namespace {
+
+// 병렬 직렬화에서 스레드 하나가 한 번에 맡는 행 수 (스레드별 버퍼 크기를 제한)
+constexpr size_t kRowsPerTask = 16 * 1024;
+
+// 숫자 셀 하나의 최대 길이 (double 최단 표현 + 부호/지수)
+constexpr size_t kMaxNumberLength = 32;
+
+// buf[used..]에 n바이트를 쓸 공간을 확보합니다 (부족하면 두 배로 키움)
+char* grow(std::vector<char>& buf, size_t used, size_t n) {
+    if (used + n > buf.size()) {
+        buf.resize(std::max(buf.size() * 2, used + n));
+    }
+    return buf.data() + used;
+}
+
+void appendField(std::vector<char>& buf, size_t& used, std::string_view value, char separator) {
+    char* out = grow(buf, used, CSV_FIELD_ENCODED_MAX(value.size()) + 1);
+    size_t written = csv_field_encode(value.data(), value.size(), out);
+    out[written++] = separator;
+    used += written;
+}
+
+template <typename T>
+void appendNumber(std::vector<char>& buf, size_t& used, T value, char separator) {
+    char* out = grow(buf, used, kMaxNumberLength + 1);
+    char* end = std::to_chars(out, out + kMaxNumberLength, value).ptr;
+    *end++ = separator;
+    used += static_cast<size_t>(end - out);
+}
+
+template <typename Row>
+void appendRow(std::vector<char>& buf, size_t& used, const Row& row) {
+    for (size_t i = 0; i < row.size(); ++i) {
+        appendField(buf, used, row[i], (i + 1 < row.size()) ? ',' : '\n');
+    }
+    if (row.empty()) {
+        *grow(buf, used, 1) = '\n';
+        ++used;
+    }
+}
+
+// 숫자 열은 텍스트 대신 값 배열에서 포맷합니다 (따옴표가 필요 없음)
+void appendTableRow(std::vector<char>& buf, size_t& used, const CSVTable& table, size_t row) {
+    const size_t cols = table.colCount();
+    for (size_t col = 0; col < cols; ++col) {
+        const CSVTable::Column& column = table.column(col);
+        const char separator = (col + 1 < cols) ? ',' : '\n';
+        switch (column.type()) {
+            case ColumnType::Int64:
+                appendNumber(buf, used, column.ints()[row], separator);
+                break;
+            case ColumnType::Double:
+                appendNumber(buf, used, column.doubles()[row], separator);
+                break;
+            default:
+                appendField(buf, used, column[row], separator);
+                break;
+        }
+    }
+    if (cols == 0) {
+        *grow(buf, used, 1) = '\n';
+        ++used;
+    }
+}
+
+} // namespace
+
+CSVWriter::CSVWriter(const std::string& filename, const WriteOptions& options)
+    : file_(filename, std::ios::binary | std::ios::trunc)
+    , filename_(filename)
+    , used_(0)
+    , options_(options) {
+    if (!file_.is_open()) {
+        throw std::runtime_error("Failed to open file for writing: " + filename);
+    }
+    if (options_.buffer_size == 0) {
+        options_.buffer_size = WriteOptions().buffer_size;
+    }
+    buffer_.resize(options_.buffer_size);
+}
+
+CSVWriter::~CSVWriter() {
+    try {
+        close();
+    } catch (...) {
+        // 소멸자에서는 예외를 던지지 않음
+    }
+}
+
+void CSVWriter::writeBytes(const char* data, size_t length) {
+    if (length > 0 && !file_.write(data, static_cast<std::streamsize>(length))) {
+        throw std::runtime_error("Failed to write file: " + filename_);
+    }
+}
+
+void CSVWriter::flush() {
+    if (!file_.is_open()) {
+        return;
+    }
+    writeBytes(buffer_.data(), used_);
+    used_ = 0;
+}
+
+void CSVWriter::close() {
+    if (!file_.is_open()) {
+        return;
+    }
+    flush();
+    file_.close();
+    if (file_.fail()) {
+        throw std::runtime_error("Failed to write file: " + filename_);
+    }
+}
+
+void CSVWriter::writeRow(const std::vector<std::string_view>& row) {
+    appendRow(buffer_, used_, row);
+    if (used_ >= options_.buffer_size) {
+        flush();
+    }
+}
+
+void CSVWriter::writeRow(const std::vector<std::string>& row) {
+    appendRow(buffer_, used_, row);
+    if (used_ >= options_.buffer_size) {
+        flush();
+    }
+}
+
+void CSVWriter::writeTable(const CSVTable& table) {
+    writeRow(table.headers());
+
+    const size_t rows = table.rowCount();
+    const size_t threads = (options_.threads == 0) ? ThreadPool::defaultThreadCount() : options_.threads;
+    if (threads <= 1 || rows < 2 * kRowsPerTask) {
+        for (size_t row = 0; row < rows; ++row) {
+            appendTableRow(buffer_, used_, table, row);
+            if (used_ >= options_.buffer_size) {
+                flush();
+            }
+        }
+        return;
+    }
+
+    // 행 구간을 스레드별 버퍼에 직렬화한 뒤 순서대로 씀 (버퍼는 회차마다 재사용)
+    flush();
+    ThreadPool pool(threads);
+    std::vector<std::vector<char>> parts(threads);
+    std::vector<size_t> used(threads);
+    const size_t batch = kRowsPerTask * threads;
+    for (size_t begin = 0; begin < rows; begin += batch) {
+        const size_t end = std::min(rows, begin + batch);
+        pool.parallelFor(threads, [&](size_t task) {
+            const size_t first = begin + (end - begin) * task / threads;
+            const size_t last = begin + (end - begin) * (task + 1) / threads;
+            used[task] = 0;
+            for (size_t row = first; row < last; ++row) {
+                appendTableRow(parts[task], used[task], table, row);
+            }
+        });
+        for (size_t task = 0; task < threads; ++task) {
+            writeBytes(parts[task].data(), used[task]);
+        }
+    }
+}
+
+} // namespace mylib
@@ -1,4 +1,5 @@
 #include "cpp/mylib/Calculator.hpp"
+#include "mylib/reduce.h"
 
 namespace mylib {
 
@@ -18,10 +19,7 @@ double Calculator::average(const std::vector<int>& numbers) {
         throw std::invalid_argument("Cannot calculate average of empty array");
     }
 
-    long long sum = 0;
-    for (int num : numbers) {
-        sum += num;
-    }
+    long long sum = reduce_sum_int(numbers.data(), numbers.size());
 
     return static_cast<double>(sum) / numbers.size();
 }
@@ -0,0 +1,317 @@
+#include "cpp/mylib/MappedFile.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mylib {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& filename, bool copy_on_write, AccessPattern access)
+    : data_(nullptr)
+    , size_(0)
+    , writable_(copy_on_write)
+    , file_handle_(INVALID_HANDLE_VALUE)
+    , mapping_handle_(nullptr) {
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (access == AccessPattern::Sequential) {
+        flags = FILE_FLAG_SEQUENTIAL_SCAN;
+    } else if (access == AccessPattern::Random) {
+        flags = FILE_FLAG_RANDOM_ACCESS;
+    }
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, flags, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+    file_handle_ = file;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        release();
+        throw std::runtime_error("Failed to stat file: " + filename);
+    }
+    BY_HANDLE_FILE_INFORMATION info;
+    if (GetFileInformationByHandle(file, &info)) {
+        identity_.device = info.dwVolumeSerialNumber;
+        identity_.inode = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_ == 0) {
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr,
+                                        copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY,
+                                        0, 0, nullptr);
+    if (mapping == nullptr) {
+        release();
+        throw std::runtime_error("Failed to map file: " + filename);
+    }
+    mapping_handle_ = mapping;
+
+    data_ = static_cast<char*>(MapViewOfFile(mapping, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ,
+                                             0, 0, 0));
+    if (data_ == nullptr) {
+        release();
+        throw std::runtime_error("Failed to map file: " + filename);
+    }
+}
+
+void MappedFile::release() {
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_ != nullptr) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    if (file_handle_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+    }
+    data_ = nullptr;
+    size_ = 0;
+    mapping_handle_ = nullptr;
+    file_handle_ = INVALID_HANDLE_VALUE;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_)
+    , size_(other.size_)
+    , writable_(other.writable_)
+    , identity_(other.identity_)
+    , file_handle_(other.file_handle_)
+    , mapping_handle_(other.mapping_handle_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.file_handle_ = INVALID_HANDLE_VALUE;
+    other.mapping_handle_ = nullptr;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+
+        data_ = other.data_;
+        size_ = other.size_;
+        writable_ = other.writable_;
+        identity_ = other.identity_;
+        file_handle_ = other.file_handle_;
+        mapping_handle_ = other.mapping_handle_;
+
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.file_handle_ = INVALID_HANDLE_VALUE;
+        other.mapping_handle_ = nullptr;
+    }
+    return *this;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename, bool copy_on_write, AccessPattern access)
+    : data_(nullptr)
+    , size_(0)
+    , writable_(copy_on_write) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Failed to stat file: " + filename);
+    }
+
+    identity_.device = static_cast<uint64_t>(st.st_dev);
+    identity_.inode = static_cast<uint64_t>(st.st_ino);
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        int prot = copy_on_write ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void* addr = mmap(nullptr, size_, prot, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            size_ = 0;
+            throw std::runtime_error("Failed to map file: " + filename);
+        }
+        data_ = static_cast<char*>(addr);
+        // 파서는 앞에서부터 한 번 훑으므로 커널에 순차 접근을 알려 read-ahead를 키웁니다
+        // (지연 파싱/스냅샷처럼 흩어진 행을 읽는 매핑은 호출자가 다른 방식을 고름)
+        if (access == AccessPattern::Sequential) {
+            madvise(addr, size_, MADV_SEQUENTIAL);
+        } else if (access == AccessPattern::Random) {
+            madvise(addr, size_, MADV_RANDOM);
+        }
+    }
+
+    // 매핑은 파일 디스크립터가 닫혀도 유지됩니다
+    ::close(fd);
+}
+
+void MappedFile::release() {
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_)
+    , size_(other.size_)
+    , writable_(other.writable_)
+    , identity_(other.identity_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+
+        data_ = other.data_;
+        size_ = other.size_;
+        writable_ = other.writable_;
+        identity_ = other.identity_;
+
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+const char* MappedFile::data() const {
+    return data_;
+}
+
+char* MappedFile::writableData() {
+    return writable_ ? data_ : nullptr;
+}
+
+size_t MappedFile::size() const {
+    return size_;
+}
+
+std::string_view MappedFile::view() const {
+    return std::string_view(data_, size_);
+}
+
+const FileIdentity& MappedFile::identity() const {
+    return identity_;
+}
+
+// ====================================
+// FileReader
+// ====================================
+
+#ifdef _WIN32
+
+FileReader::FileReader(const std::string& filename)
+    : size_(0)
+    , handle_(INVALID_HANDLE_VALUE) {
+    // 다른 프로세스가 계속 쓰거나 로테이션할 수 있도록 쓰기/삭제도 공유
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        throw std::runtime_error("Failed to stat file: " + filename);
+    }
+    BY_HANDLE_FILE_INFORMATION info;
+    if (GetFileInformationByHandle(file, &info)) {
+        identity_.device = info.dwVolumeSerialNumber;
+        identity_.inode = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+    }
+    size_ = static_cast<uint64_t>(file_size.QuadPart);
+    handle_ = file;
+}
+
+FileReader::~FileReader() {
+    CloseHandle(static_cast<HANDLE>(handle_));
+}
+
+size_t FileReader::read(uint64_t offset, char* dst, size_t length) const {
+    size_t total = 0;
+    while (total < length) {
+        OVERLAPPED overlapped = {};
+        const uint64_t position = offset + total;
+        overlapped.Offset = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+        const DWORD request = static_cast<DWORD>(std::min<size_t>(length - total, 0x40000000u));
+        DWORD n = 0;
+        if (!ReadFile(static_cast<HANDLE>(handle_), dst + total, request, &n, &overlapped)) {
+            if (GetLastError() == ERROR_HANDLE_EOF) {
+                break;
+            }
+            throw std::runtime_error("Failed to read file");
+        }
+        if (n == 0) {
+            break;
+        }
+        total += n;
+    }
+    return total;
+}
+
+#else
+
+FileReader::FileReader(const std::string& filename)
+    : size_(0)
+    , fd_(::open(filename.c_str(), O_RDONLY)) {
+    if (fd_ < 0) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+        ::close(fd_);
+        throw std::runtime_error("Failed to stat file: " + filename);
+    }
+    identity_.device = static_cast<uint64_t>(st.st_dev);
+    identity_.inode = static_cast<uint64_t>(st.st_ino);
+    size_ = static_cast<uint64_t>(st.st_size);
+}
+
+FileReader::~FileReader() {
+    ::close(fd_);
+}
+
+size_t FileReader::read(uint64_t offset, char* dst, size_t length) const {
+    size_t total = 0;
+    while (total < length) {
+        const ssize_t n = pread(fd_, dst + total, length - total, static_cast<off_t>(offset + total));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("Failed to read file");
+        }
+        if (n == 0) {
+            break;  // 그 사이 잘렸으면 읽은 만큼만
+        }
+        total += static_cast<size_t>(n);
+    }
+    return total;
+}
+
+#endif
+
+} // namespace mylib
@@ -0,0 +1,89 @@
+#include "cpp/mylib/ThreadPool.hpp"
+#include <exception>
+
+namespace mylib {
+
+ThreadPool::ThreadPool(size_t threads)
+    : stopping_(false) {
+    if (threads == 0) {
+        threads = defaultThreadCount();
+    }
+
+    workers_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;  // stopping_이고 남은 작업 없음
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+        task();
+    }
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task) {
+    std::packaged_task<void()> packaged(std::move(task));
+    std::future<void> result = packaged.get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push(std::move(packaged));
+    }
+    condition_.notify_one();
+    return result;
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    std::vector<std::future<void>> pending;
+    pending.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        pending.push_back(submit([&fn, i] { fn(i); }));
+    }
+
+    // 모든 작업이 끝나야 fn이 참조하는 지역 변수를 안전하게 해제할 수 있음
+    std::exception_ptr first_error;
+    for (auto& future : pending) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+size_t ThreadPool::size() const {
+    return workers_.size();
+}
+
+size_t ThreadPool::defaultThreadCount() {
+    unsigned count = std::thread::hardware_concurrency();
+    return (count > 0) ? count : 1;
+}
+
+} // namespace mylib
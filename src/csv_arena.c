@@ -0,0 +1,133 @@
+#include "mylib/csv_arena.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_BLOCK_SIZE (256 * 1024)  /* 기본 블록 크기 */
+#define ARENA_MAX_ALIGN 16
+
+/**
+ * @brief 블록 머리 (뒤에 데이터가 이어짐)
+ *
+ * 데이터 시작이 ARENA_MAX_ALIGN에 맞도록 머리 크기를 16바이트 배수로 채웁니다.
+ */
+struct CSVArenaBlock {
+    CSVArenaBlock *next;
+    size_t capacity;
+    char padding[ARENA_MAX_ALIGN - (2 * sizeof(void *)) % ARENA_MAX_ALIGN];
+};
+
+static char* block_data(CSVArenaBlock *block) {
+    return (char *)(block + 1);
+}
+
+void csv_arena_init(CSVArena *arena) {
+    arena->head = NULL;
+    arena->cursor = NULL;
+    arena->limit = NULL;
+}
+
+/**
+ * @brief 새 블록을 만들어 목록에 연결합니다
+ * @param current 1이면 이후 할당에 쓸 현재 블록으로 삼음, 0이면 전용 블록
+ * @return 블록 데이터 시작, 실패 시 NULL
+ */
+static char* arena_add_block(CSVArena *arena, size_t capacity, int current) {
+    CSVArenaBlock *block = (CSVArenaBlock *)malloc(sizeof(CSVArenaBlock) + capacity);
+    if (block == NULL) {
+        return NULL;
+    }
+    block->capacity = capacity;
+
+    if (current || arena->head == NULL) {
+        block->next = arena->head;
+        arena->head = block;
+        if (current) {
+            arena->cursor = block_data(block);
+            arena->limit = block_data(block) + capacity;
+        }
+    } else {
+        /* 전용 블록은 현재 블록 뒤에 끼워 남은 공간을 계속 씀 */
+        block->next = arena->head->next;
+        arena->head->next = block;
+    }
+    return block_data(block);
+}
+
+void* csv_arena_alloc(CSVArena *arena, size_t size, size_t align) {
+    if (align == 0) {
+        align = 1;
+    }
+
+    if (arena->cursor != NULL) {
+        uintptr_t address = ((uintptr_t)arena->cursor + (align - 1)) & ~(uintptr_t)(align - 1);
+        char *aligned = (char *)address;
+        if (aligned <= arena->limit && size <= (size_t)(arena->limit - aligned)) {
+            arena->cursor = aligned + size;
+            return aligned;
+        }
+    }
+
+    /* 큰 요청은 전용 블록으로 (현재 블록의 남은 공간을 버리지 않음) */
+    if (size > ARENA_BLOCK_SIZE / 4) {
+        return arena_add_block(arena, size, 0);
+    }
+
+    char *data = arena_add_block(arena, ARENA_BLOCK_SIZE, 1);
+    if (data == NULL) {
+        return NULL;
+    }
+    arena->cursor = data + size;
+    return data;
+}
+
+char* csv_arena_strndup(CSVArena *arena, const char *str, size_t length) {
+    char *copy = (char *)csv_arena_alloc(arena, length + 1, 1);
+    if (copy == NULL) {
+        return NULL;
+    }
+    memcpy(copy, str, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+void csv_arena_merge(CSVArena *dst, CSVArena *src) {
+    if (src->head == NULL) {
+        return;
+    }
+
+    if (dst->head == NULL) {
+        *dst = *src;
+    } else {
+        /* src 목록을 dst의 현재 블록 뒤에 이어 붙임 (dst의 현재 블록은 유지) */
+        CSVArenaBlock *tail = src->head;
+        while (tail->next != NULL) {
+            tail = tail->next;
+        }
+        tail->next = dst->head->next;
+        dst->head->next = src->head;
+    }
+    csv_arena_init(src);
+}
+
+void csv_arena_free(CSVArena *arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    CSVArenaBlock *block = arena->head;
+    while (block != NULL) {
+        CSVArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    csv_arena_init(arena);
+}
+
+size_t csv_arena_block_count(const CSVArena *arena) {
+    size_t count = 0;
+    for (const CSVArenaBlock *block = arena->head; block != NULL; block = block->next) {
+        count++;
+    }
+    return count;
+}
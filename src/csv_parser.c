@@ -1,229 +1,717 @@
 #include "mylib/csv_parser.h"
+#include "mylib/csv_readahead.h"
+#include "mylib/csv_snapshot.h"
+#include "mylib/csv_tokenizer.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_LINE_LENGTH 4096
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 #define INITIAL_ROW_CAPACITY 16
+#define MIN_CHUNK_BYTES (64 * 1024)  /* 스레드 하나가 맡을 최소 바이트 수 */
+#define STREAM_BLOCK_SIZE (1024 * 1024)  /* 스트림이 한 번에 읽는 바이트 수 */
+#define STREAM_READAHEAD_DEPTH 4         /* 미리 읽어 둘 블록 수 */
+#define WRITE_BUFFER_SIZE (1024 * 1024)  /* csv_write()가 한 번에 쓰는 바이트 수 */
 
 /**
- * @brief 문자열을 복사합니다 (strdup 대체)
+ * @brief 행 배열 끝에 행을 추가합니다 (필요하면 2배 확장)
+ * @return 성공 시 0, 실패 시 -1
  */
-static char* string_duplicate(const char *str) {
-    if (str == NULL) {
-        return NULL;
+static int append_row(char ****rows, size_t *row_count, size_t *row_capacity, char **fields) {
+    if (*row_count >= *row_capacity) {
+        size_t new_capacity = (*row_capacity == 0) ? INITIAL_ROW_CAPACITY : *row_capacity * 2;
+        char ***new_rows = (char ***)realloc(*rows, new_capacity * sizeof(char **));
+        if (new_rows == NULL) {
+            return -1;
+        }
+        *rows = new_rows;
+        *row_capacity = new_capacity;
     }
 
-    size_t len = strlen(str);
-    char *dup = (char *)malloc(len + 1);
-    if (dup == NULL) {
+    (*rows)[(*row_count)++] = fields;
+    return 0;
+}
+
+/**
+ * @brief 토큰화된 레코드를 필드 문자열 배열로 변환합니다
+ * @param arena 필드 배열과 문자열을 할당할 아레나
+ * @param record 토크나이저가 채운 레코드
+ * @param columns 복원할 필드 인덱스 (NULL이면 모든 필드)
+ * @param column_count columns의 개수
+ * @return 필드 배열 (columns가 NULL이면 record->count개, 아니면 column_count개), 실패 시 NULL
+ *
+ * @note 실패 시 이미 할당한 메모리는 아레나와 함께 해제됩니다
+ */
+static char** record_to_fields(CSVArena *arena, const CSVRecord *record,
+                               const size_t *columns, size_t column_count) {
+    size_t count = (columns != NULL) ? column_count : record->count;
+    char **fields = (char **)csv_arena_alloc(arena, count * sizeof(char *), sizeof(char *));
+    if (fields == NULL) {
         return NULL;
     }
 
-    memcpy(dup, str, len + 1);
-    return dup;
+    for (size_t i = 0; i < count; i++) {
+        const CSVField *field = &record->fields[(columns != NULL) ? columns[i] : i];
+        char *value = (char *)csv_arena_alloc(arena, field->length + 1, 1);
+        if (value == NULL) {
+            return NULL;
+        }
+        value[csv_field_decode(field, value)] = '\0';
+        fields[i] = value;
+    }
+
+    return fields;
 }
 
 /**
- * @brief 문자열 끝의 개행 문자를 제거합니다
+ * @brief 스트림의 데이터 행을 읽어 CSVData를 만듭니다
+ * @param stream 헤더를 읽은 스트림
+ * @param columns 복원할 열 인덱스 (NULL이면 전체)
+ * @param column_count columns의 개수
+ * @return 파싱된 CSV 데이터, 실패 시 NULL
  */
-static void trim_newline(char *str) {
-    if (str == NULL) {
-        return;
+static CSVData* parse_from_stream(CSVStream *stream, const size_t *columns, size_t column_count) {
+    CSVData *data = (CSVData *)malloc(sizeof(CSVData));
+    if (data == NULL) {
+        return NULL;
     }
 
-    size_t len = strlen(str);
-    while (len > 0 && (str[len - 1] == '\n' || str[len - 1] == '\r')) {
-        str[len - 1] = '\0';
-        len--;
+    data->headers = NULL;
+    data->rows = NULL;
+    data->row_count = 0;
+    data->col_count = 0;
+    csv_arena_init(&data->arena);
+    data->snapshot = NULL;
+    data->snapshot_size = 0;
+
+    size_t row_capacity = 0;
+    int failed = 0;
+
+    /* 헤더 행: 스트림이 닫히면 사라지므로 결과 아레나로 복사 */
+    size_t header_count = 0;
+    char **headers = csv_stream_headers(stream, &header_count);
+    if (headers != NULL) {
+        data->col_count = (columns != NULL) ? column_count : header_count;
+        data->headers = (char **)csv_arena_alloc(&data->arena, data->col_count * sizeof(char *), sizeof(char *));
+        failed = (data->headers == NULL);
+        for (size_t i = 0; !failed && i < data->col_count; i++) {
+            const char *name = headers[(columns != NULL) ? columns[i] : i];
+            data->headers[i] = csv_arena_strndup(&data->arena, name, strlen(name));
+            failed = (data->headers[i] == NULL);
+        }
+    }
+
+    /* 데이터 행: 블록 버퍼의 필드를 결과 아레나로 한 번만 복원 (빠진 열은 복사하지 않음) */
+    const CSVRecord *record;
+    int status = 0;
+    while (!failed && (status = csv_stream_next_record(stream, &record)) == 1) {
+        if (record->count != header_count) {
+            continue;  /* 열 개수 불일치 - 무시 */
+        }
+
+        char **fields = record_to_fields(&data->arena, record, columns, column_count);
+        failed = (fields == NULL ||
+                  append_row(&data->rows, &data->row_count, &row_capacity, fields) != 0);
+    }
+
+    if (failed || status < 0) {
+        csv_destroy(data);
+        return NULL;
     }
+    return data;
 }
 
-/**
- * @brief CSV 행을 파싱하여 필드 배열로 변환합니다
- * @param line 파싱할 행
- * @param field_count 필드 개수를 저장할 포인터
- * @return 필드 배열, 실패 시 NULL
- */
-static char** parse_csv_line(const char *line, size_t *field_count) {
-    if (line == NULL || field_count == NULL) {
+CSVData* csv_parse(const char *filename) {
+    /* 블록 단위로 읽고 버퍼 안에서 바로 토큰화하므로 줄 길이 제한이 없음 */
+    CSVStream *stream = csv_stream_open(filename);
+    if (stream == NULL) {
         return NULL;
     }
 
-    size_t capacity = 8;
-    char **fields = (char **)malloc(capacity * sizeof(char *));
-    if (fields == NULL) {
+    CSVData *data = parse_from_stream(stream, NULL, 0);
+    csv_stream_close(stream);
+    return data;
+}
+
+CSVData* csv_parse_columns(const char *filename, const char *const *columns, size_t column_count) {
+    if (columns == NULL || column_count == 0) {
+        return csv_parse(filename);
+    }
+
+    CSVStream *stream = csv_stream_open(filename);
+    if (stream == NULL) {
         return NULL;
     }
 
-    *field_count = 0;
-    const char *ptr = line;
-    char buffer[MAX_LINE_LENGTH];
-    size_t buf_pos = 0;
-    int in_quotes = 0;
-
-    while (*ptr != '\0') {
-        if (*ptr == '"') {
-            /* 따옴표 토글 */
-            in_quotes = !in_quotes;
-            ptr++;
-        } else if (*ptr == ',' && !in_quotes) {
-            /* 필드 구분자 */
-            buffer[buf_pos] = '\0';
-
-            /* 용량 확장 */
-            if (*field_count >= capacity) {
-                capacity *= 2;
-                char **new_fields = (char **)realloc(fields, capacity * sizeof(char *));
-                if (new_fields == NULL) {
-                    /* 메모리 할당 실패 - 정리 */
-                    for (size_t i = 0; i < *field_count; i++) {
-                        free(fields[i]);
-                    }
-                    free(fields);
-                    return NULL;
-                }
-                fields = new_fields;
+    /* 열 이름은 헤더에서 한 번만 찾아 인덱스로 바꿈 */
+    size_t header_count = 0;
+    char **headers = csv_stream_headers(stream, &header_count);
+    size_t *indices = (size_t *)malloc(column_count * sizeof(size_t));
+    int resolved = (indices != NULL);
+
+    for (size_t i = 0; resolved && i < column_count; i++) {
+        resolved = 0;
+        for (size_t j = 0; columns[i] != NULL && j < header_count; j++) {
+            if (strcmp(headers[j], columns[i]) == 0) {
+                indices[i] = j;
+                resolved = 1;
+                break;
             }
+        }
+    }
 
-            fields[*field_count] = string_duplicate(buffer);
-            if (fields[*field_count] == NULL) {
-                /* 메모리 할당 실패 - 정리 */
-                for (size_t i = 0; i < *field_count; i++) {
-                    free(fields[i]);
-                }
-                free(fields);
-                return NULL;
-            }
-            (*field_count)++;
-            buf_pos = 0;
-            ptr++;
+    CSVData *data = resolved ? parse_from_stream(stream, indices, column_count) : NULL;
+    free(indices);
+    csv_stream_close(stream);
+    return data;
+}
+
+/* ====================================
+ * 멀티스레드 파싱
+ * ==================================== */
+
+/**
+ * @brief 스레드에서 실행할 작업
+ */
+typedef struct {
+    void (*fn)(void *arg);
+    void *arg;
+} ThreadTask;
+
+#ifdef _WIN32
+typedef HANDLE ThreadHandle;
+
+static DWORD WINAPI thread_entry(LPVOID param) {
+    ThreadTask *task = (ThreadTask *)param;
+    task->fn(task->arg);
+    return 0;
+}
+
+static int thread_start(ThreadHandle *thread, ThreadTask *task) {
+    *thread = CreateThread(NULL, 0, thread_entry, task, 0, NULL);
+    return (*thread != NULL) ? 0 : -1;
+}
+
+static void thread_join(ThreadHandle thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+static size_t hardware_threads(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwNumberOfProcessors;
+}
+#else
+typedef pthread_t ThreadHandle;
+
+static void* thread_entry(void *param) {
+    ThreadTask *task = (ThreadTask *)param;
+    task->fn(task->arg);
+    return NULL;
+}
+
+static int thread_start(ThreadHandle *thread, ThreadTask *task) {
+    return (pthread_create(thread, NULL, thread_entry, task) == 0) ? 0 : -1;
+}
+
+static void thread_join(ThreadHandle thread) {
+    pthread_join(thread, NULL);
+}
+
+static size_t hardware_threads(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (size_t)count : 1;
+}
+#endif
+
+/**
+ * @brief 작업들을 병렬로 실행하고 모두 끝날 때까지 기다립니다
+ *
+ * 첫 번째 작업은 호출한 스레드에서 실행합니다.
+ * 스레드를 만들 수 없으면 해당 작업을 직접 실행하므로 결과는 항상 같습니다.
+ */
+static void run_tasks(ThreadTask *tasks, size_t count) {
+    ThreadHandle *threads = NULL;
+    int *started = NULL;
+
+    if (count > 1) {
+        threads = (ThreadHandle *)malloc(count * sizeof(ThreadHandle));
+        started = (int *)calloc(count, sizeof(int));
+    }
+
+    for (size_t i = 1; i < count; i++) {
+        if (threads != NULL && started != NULL && thread_start(&threads[i], &tasks[i]) == 0) {
+            started[i] = 1;
         } else {
-            /* 일반 문자 */
-            if (buf_pos < MAX_LINE_LENGTH - 1) {
-                buffer[buf_pos++] = *ptr;
-            }
-            ptr++;
+            tasks[i].fn(tasks[i].arg);
         }
     }
 
-    /* 마지막 필드 추가 */
-    buffer[buf_pos] = '\0';
+    if (count > 0) {
+        tasks[0].fn(tasks[0].arg);
+    }
 
-    if (*field_count >= capacity) {
-        capacity++;
-        char **new_fields = (char **)realloc(fields, capacity * sizeof(char *));
-        if (new_fields == NULL) {
-            for (size_t i = 0; i < *field_count; i++) {
-                free(fields[i]);
-            }
-            free(fields);
-            return NULL;
+    for (size_t i = 1; i < count; i++) {
+        if (started != NULL && started[i]) {
+            thread_join(threads[i]);
         }
-        fields = new_fields;
     }
 
-    fields[*field_count] = string_duplicate(buffer);
-    if (fields[*field_count] == NULL) {
-        for (size_t i = 0; i < *field_count; i++) {
-            free(fields[i]);
-        }
-        free(fields);
+    free(threads);
+    free(started);
+}
+
+/**
+ * @brief 파일 전체를 메모리로 읽습니다
+ * @return 읽은 버퍼 (호출자가 free), 실패 시 NULL
+ */
+static char* read_whole_file(const char *filename, size_t *size) {
+    FILE *file = fopen(filename, "rb");
+    if (file == NULL) {
         return NULL;
     }
-    (*field_count)++;
 
-    return fields;
+    if (fseek(file, 0, SEEK_END) != 0) {
+        fclose(file);
+        return NULL;
+    }
+    long length = ftell(file);
+    if (length < 0 || fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return NULL;
+    }
+
+    /* 빈 파일도 유효한 포인터를 돌려주도록 최소 1바이트 할당 */
+    char *buffer = (char *)malloc((size_t)length + 1);
+    if (buffer == NULL) {
+        fclose(file);
+        return NULL;
+    }
+
+    *size = fread(buffer, 1, (size_t)length, file);
+    fclose(file);
+    return buffer;
 }
 
-CSVData* csv_parse(const char *filename) {
+/**
+ * @brief 청크 하나의 파싱 작업과 결과
+ */
+typedef struct {
+    const char *data;      /**< 청크 시작 위치 */
+    size_t length;         /**< 청크 길이 */
+    size_t col_count;      /**< 헤더 열 개수 (불일치 행은 무시) */
+    size_t quote_count;    /**< 1단계: 청크의 따옴표 개수 */
+    CSVArena arena;        /**< 2단계: 행/셀 메모리 (결과에 합쳐짐) */
+    char ***rows;          /**< 2단계: 파싱된 행 */
+    size_t row_count;
+    size_t row_capacity;
+    int failed;            /**< 메모리 할당 실패 여부 */
+} ChunkJob;
+
+static void count_chunk_quotes(void *arg) {
+    ChunkJob *job = (ChunkJob *)arg;
+    job->quote_count = csv_scan_count_quotes(job->data, job->length);
+}
+
+static void parse_chunk(void *arg) {
+    ChunkJob *job = (ChunkJob *)arg;
+    CSVTokenizer tokenizer;
+    CSVRecord record;
+    int status;
+
+    csv_record_init(&record);
+    csv_tokenizer_init(&tokenizer, job->data, job->length, 1);
+
+    while ((status = csv_tokenizer_next(&tokenizer, &record)) == 1) {
+        if (record.count != job->col_count) {
+            continue;  /* 열 개수 불일치 - csv_parse와 동일하게 무시 */
+        }
+
+        char **fields = record_to_fields(&job->arena, &record, NULL, 0);
+        if (fields == NULL ||
+            append_row(&job->rows, &job->row_count, &job->row_capacity, fields) != 0) {
+            status = -1;
+            break;
+        }
+    }
+
+    job->failed = (status < 0);
+    csv_record_free(&record);
+}
+
+static void free_chunk_rows(ChunkJob *job) {
+    csv_arena_free(&job->arena);
+    free(job->rows);
+    job->rows = NULL;
+    job->row_count = 0;
+}
+
+CSVData* csv_parse_parallel(const char *filename, size_t num_threads) {
     if (filename == NULL) {
         return NULL;
     }
 
-    FILE *file = fopen(filename, "r");
-    if (file == NULL) {
+    size_t size = 0;
+    char *buffer = read_whole_file(filename, &size);
+    if (buffer == NULL) {
         return NULL;
     }
 
     CSVData *data = (CSVData *)malloc(sizeof(CSVData));
     if (data == NULL) {
-        fclose(file);
+        free(buffer);
         return NULL;
     }
-
     data->headers = NULL;
     data->rows = NULL;
     data->row_count = 0;
     data->col_count = 0;
+    csv_arena_init(&data->arena);
+    data->snapshot = NULL;
+    data->snapshot_size = 0;
+
+    /* 헤더는 순차적으로 읽음 */
+    CSVTokenizer tokenizer;
+    CSVRecord record;
+    csv_record_init(&record);
+    csv_tokenizer_init(&tokenizer, buffer, size, 1);
+
+    int status = csv_tokenizer_next(&tokenizer, &record);
+    if (status == 1) {
+        data->headers = record_to_fields(&data->arena, &record, NULL, 0);
+        data->col_count = record.count;
+    }
+    csv_record_free(&record);
+    if (status < 0 || (status == 1 && data->headers == NULL)) {
+        free(buffer);
+        csv_destroy(data);
+        return NULL;
+    }
 
-    char line[MAX_LINE_LENGTH];
-    int is_first_line = 1;
-    size_t row_capacity = INITIAL_ROW_CAPACITY;
+    size_t body_start = tokenizer.pos;
+    size_t body_size = size - body_start;
 
-    data->rows = (char ***)malloc(row_capacity * sizeof(char **));
-    if (data->rows == NULL) {
-        free(data);
-        fclose(file);
+    if (num_threads == 0) {
+        num_threads = hardware_threads();
+    }
+    size_t chunk_count = body_size / MIN_CHUNK_BYTES;
+    if (chunk_count > num_threads) {
+        chunk_count = num_threads;
+    }
+    if (chunk_count == 0) {
+        chunk_count = 1;
+    }
+
+    size_t *bounds = (size_t *)malloc((chunk_count + 1) * sizeof(size_t));
+    size_t *quote_counts = (size_t *)malloc(chunk_count * sizeof(size_t));
+    ChunkJob *jobs = (ChunkJob *)calloc(chunk_count, sizeof(ChunkJob));
+    ThreadTask *tasks = (ThreadTask *)malloc(chunk_count * sizeof(ThreadTask));
+    if (bounds == NULL || quote_counts == NULL || jobs == NULL || tasks == NULL) {
+        free(bounds);
+        free(quote_counts);
+        free(jobs);
+        free(tasks);
+        free(buffer);
+        csv_destroy(data);
         return NULL;
     }
 
-    while (fgets(line, sizeof(line), file) != NULL) {
-        trim_newline(line);
+    /* 1단계: 균등 분할 후 구간별 따옴표 개수를 병렬로 셈 */
+    csv_chunk_plan(body_start, size, chunk_count, bounds);
+    for (size_t i = 0; i < chunk_count; i++) {
+        jobs[i].data = buffer + bounds[i];
+        jobs[i].length = bounds[i + 1] - bounds[i];
+        tasks[i].fn = count_chunk_quotes;
+        tasks[i].arg = &jobs[i];
+    }
+    run_tasks(tasks, chunk_count);
+
+    /* 2단계: 따옴표 상태를 누적하여 경계를 레코드 시작으로 옮긴 뒤 병렬 파싱 */
+    for (size_t i = 0; i < chunk_count; i++) {
+        quote_counts[i] = jobs[i].quote_count;
+    }
+    csv_chunk_align(buffer, chunk_count, quote_counts, bounds);
+    for (size_t i = 0; i < chunk_count; i++) {
+        jobs[i].data = buffer + bounds[i];
+        jobs[i].length = bounds[i + 1] - bounds[i];
+        jobs[i].col_count = data->col_count;
+        csv_arena_init(&jobs[i].arena);
+        tasks[i].fn = parse_chunk;
+    }
+    run_tasks(tasks, chunk_count);
+
+    /* 3단계: 청크 순서대로 행 포인터를 이어 붙이고 아레나 블록을 넘겨받음 (셀은 다시 복사하지 않음) */
+    int failed = 0;
+    size_t total_rows = 0;
+    for (size_t i = 0; i < chunk_count; i++) {
+        failed |= jobs[i].failed;
+        total_rows += jobs[i].row_count;
+    }
+    if (!failed) {
+        data->rows = (char ***)malloc((total_rows > 0 ? total_rows : 1) * sizeof(char **));
+        failed = (data->rows == NULL);
+    }
 
-        /* 빈 줄 건너뛰기 */
-        if (strlen(line) == 0) {
+    for (size_t i = 0; i < chunk_count; i++) {
+        if (failed) {
+            free_chunk_rows(&jobs[i]);
             continue;
         }
+        if (jobs[i].row_count > 0) {
+            memcpy(data->rows + data->row_count, jobs[i].rows, jobs[i].row_count * sizeof(char **));
+            data->row_count += jobs[i].row_count;
+        }
+        csv_arena_merge(&data->arena, &jobs[i].arena);
+        free(jobs[i].rows);
+    }
 
-        size_t field_count;
-        char **fields = parse_csv_line(line, &field_count);
+    free(bounds);
+    free(quote_counts);
+    free(jobs);
+    free(tasks);
+    free(buffer);
 
-        if (fields == NULL) {
-            csv_destroy(data);
-            fclose(file);
-            return NULL;
+    if (failed) {
+        csv_destroy(data);
+        return NULL;
+    }
+    return data;
+}
+
+/* ====================================
+ * 스트리밍 읽기
+ * ==================================== */
+
+struct CSVStream {
+    CSVReadAhead *reader;    /**< 블록을 미리 읽어 두는 리더 (생산자 스레드) */
+    char *buffer;            /**< 블록 버퍼 (NUL 종료용 1바이트 여유 포함) */
+    size_t capacity;         /**< 버퍼 용량 (여유 바이트 제외) */
+    size_t length;           /**< 버퍼에 들어 있는 바이트 수 */
+    int eof;                 /**< 파일 끝까지 읽었는지 여부 */
+    CSVTokenizer tokenizer;  /**< 현재 버퍼의 토크나이저 */
+    CSVRecord record;        /**< 재사용하는 레코드 */
+    char **values;           /**< csv_stream_next()가 돌려주는 필드 포인터 배열 */
+    size_t values_capacity;
+    CSVArena arena;          /**< 헤더 복사본 */
+    char **headers;
+    size_t header_count;
+};
+
+/**
+ * @brief 소비한 바이트를 버리고 버퍼 뒤쪽을 파일에서 채웁니다
+ *
+ * 끊긴 레코드(아직 소비하지 않은 부분)는 버퍼 앞으로 옮깁니다.
+ * 레코드 하나가 버퍼 전체보다 길면 버퍼를 2배로 키웁니다.
+ *
+ * @return 성공 시 0, 실패 시 -1
+ */
+static int stream_fill(CSVStream *stream) {
+    size_t consumed = stream->tokenizer.pos;
+    size_t remaining = stream->length - consumed;
+
+    if (consumed > 0) {
+        memmove(stream->buffer, stream->buffer + consumed, remaining);
+    } else if (remaining == stream->capacity) {
+        size_t new_capacity = stream->capacity * 2;
+        char *new_buffer = (char *)realloc(stream->buffer, new_capacity + 1);
+        if (new_buffer == NULL) {
+            return -1;
         }
+        stream->buffer = new_buffer;
+        stream->capacity = new_capacity;
+    }
+    stream->length = remaining;
 
-        if (is_first_line) {
-            /* 헤더 행 */
-            data->headers = fields;
-            data->col_count = field_count;
-            is_first_line = 0;
-        } else {
-            /* 데이터 행 */
-            if (field_count != data->col_count) {
-                /* 열 개수 불일치 - 무시하거나 에러 처리 */
-                for (size_t i = 0; i < field_count; i++) {
-                    free(fields[i]);
-                }
-                free(fields);
-                continue;
-            }
+    size_t request = stream->capacity - stream->length;
+    size_t n = csv_readahead_read(stream->reader, stream->buffer + stream->length, request);
+    stream->length += n;
+    if (csv_readahead_error(stream->reader)) {
+        return -1;
+    }
+    stream->eof = (n < request) ? 1 : 0;
 
-            /* 용량 확장 */
-            if (data->row_count >= row_capacity) {
-                row_capacity *= 2;
-                char ***new_rows = (char ***)realloc(data->rows, row_capacity * sizeof(char **));
-                if (new_rows == NULL) {
-                    for (size_t i = 0; i < field_count; i++) {
-                        free(fields[i]);
-                    }
-                    free(fields);
-                    csv_destroy(data);
-                    fclose(file);
-                    return NULL;
-                }
-                data->rows = new_rows;
+    csv_tokenizer_init(&stream->tokenizer, stream->buffer, stream->length, stream->eof);
+    return 0;
+}
+
+int csv_stream_next_record(CSVStream *stream, const CSVRecord **record) {
+    if (stream == NULL || record == NULL) {
+        return -1;
+    }
+
+    for (;;) {
+        int status = csv_tokenizer_next(&stream->tokenizer, &stream->record);
+        if (status != 0) {
+            if (status == 1) {
+                *record = &stream->record;
             }
+            return status;
+        }
+        if (stream->eof) {
+            return 0;
+        }
+        if (stream_fill(stream) != 0) {
+            return -1;
+        }
+    }
+}
 
-            data->rows[data->row_count] = fields;
-            data->row_count++;
+/**
+ * @brief 현재 레코드의 필드를 버퍼 안에서 복원하고 NUL 종료합니다
+ *
+ * 필드 뒤의 구분자 자리에 NUL을 쓰므로 레코드를 다 읽은 뒤에만 호출합니다.
+ * 마지막 필드가 버퍼 끝에 닿아도 여유 1바이트가 있어 안전합니다.
+ *
+ * @return 성공 시 0, 실패 시 -1
+ */
+static int stream_decode_record(CSVStream *stream) {
+    CSVRecord *record = &stream->record;
+
+    if (record->count > stream->values_capacity) {
+        char **new_values = (char **)realloc(stream->values, record->count * sizeof(char *));
+        if (new_values == NULL) {
+            return -1;
         }
+        stream->values = new_values;
+        stream->values_capacity = record->count;
     }
 
-    fclose(file);
-    return data;
+    for (size_t i = 0; i < record->count; i++) {
+        char *value = (char *)record->fields[i].data;
+        value[csv_field_decode(&record->fields[i], value)] = '\0';
+        stream->values[i] = value;
+    }
+    return 0;
+}
+
+CSVStream* csv_stream_open(const char *filename) {
+    if (filename == NULL) {
+        return NULL;
+    }
+
+    CSVStream *stream = (CSVStream *)calloc(1, sizeof(CSVStream));
+    if (stream == NULL) {
+        return NULL;
+    }
+    csv_record_init(&stream->record);
+    csv_arena_init(&stream->arena);
+
+    stream->reader = csv_readahead_open(filename, STREAM_BLOCK_SIZE, STREAM_READAHEAD_DEPTH);
+    stream->capacity = STREAM_BLOCK_SIZE;
+    stream->buffer = (char *)malloc(stream->capacity + 1);
+    if (stream->reader == NULL || stream->buffer == NULL) {
+        csv_stream_close(stream);
+        return NULL;
+    }
+    csv_tokenizer_init(&stream->tokenizer, stream->buffer, 0, 0);
+
+    /* 헤더 행 읽기 (버퍼는 재사용되므로 복사해 둠) */
+    const CSVRecord *header;
+    int status = csv_stream_next_record(stream, &header);
+    if (status < 0) {
+        csv_stream_close(stream);
+        return NULL;
+    }
+    if (status == 1) {
+        stream->headers = record_to_fields(&stream->arena, header, NULL, 0);
+        if (stream->headers == NULL) {
+            csv_stream_close(stream);
+            return NULL;
+        }
+        stream->header_count = header->count;
+    }
+
+    return stream;
+}
+
+char** csv_stream_headers(const CSVStream *stream, size_t *count) {
+    if (stream == NULL) {
+        if (count != NULL) {
+            *count = 0;
+        }
+        return NULL;
+    }
+
+    if (count != NULL) {
+        *count = stream->header_count;
+    }
+    return stream->headers;
+}
+
+int csv_stream_next(CSVStream *stream, char ***fields, size_t *count) {
+    if (stream == NULL || fields == NULL || count == NULL) {
+        return -1;
+    }
+
+    const CSVRecord *record;
+    int status = csv_stream_next_record(stream, &record);
+    if (status != 1) {
+        return status;
+    }
+    if (stream_decode_record(stream) != 0) {
+        return -1;
+    }
+
+    *fields = stream->values;
+    *count = record->count;
+    return 1;
+}
+
+int csv_stream_io_stats(const CSVStream *stream, CSVReadAheadStats *stats) {
+    if (stream == NULL || stats == NULL) {
+        return -1;
+    }
+    csv_readahead_stats(stream->reader, stats);
+    return 0;
+}
+
+void csv_stream_close(CSVStream *stream) {
+    if (stream == NULL) {
+        return;
+    }
+
+    csv_readahead_close(stream->reader);
+    csv_arena_free(&stream->arena);
+    csv_record_free(&stream->record);
+    free(stream->values);
+    free(stream->buffer);
+    free(stream);
+}
+
+int csv_parse_stream(const char *filename, CSVRowCallback callback, void *user) {
+    if (callback == NULL) {
+        return -1;
+    }
+
+    CSVStream *stream = csv_stream_open(filename);
+    if (stream == NULL) {
+        return -1;
+    }
+
+    char **fields;
+    size_t count;
+    int status;
+    int result = 0;
+
+    while ((status = csv_stream_next(stream, &fields, &count)) == 1) {
+        if (callback(fields, count, user) != 0) {
+            result = 1;
+            break;
+        }
+    }
+    if (status < 0) {
+        result = -1;
+    }
+
+    csv_stream_close(stream);
+    return result;
 }
 
 const char* csv_get(const CSVData *data, size_t row, size_t col) {
@@ -287,38 +775,196 @@ void csv_print(const CSVData *data) {
     }
 }
 
+/**
+ * @brief csv_write()의 출력 버퍼 (가득 차면 한 번에 fwrite)
+ */
+typedef struct {
+    FILE *file;
+    char *data;
+    size_t used;
+    size_t capacity;
+    int failed;
+} WriteBuffer;
+
+static void write_buffer_flush(WriteBuffer *wb) {
+    if (wb->used > 0 && !wb->failed && fwrite(wb->data, 1, wb->used, wb->file) != wb->used) {
+        wb->failed = 1;
+    }
+    wb->used = 0;
+}
+
+/**
+ * @brief n바이트를 쓸 공간을 확보합니다 (버퍼보다 큰 셀은 버퍼를 키움)
+ * @return 쓸 위치, 실패 시 NULL
+ */
+static char* write_buffer_reserve(WriteBuffer *wb, size_t n) {
+    if (wb->used + n > wb->capacity) {
+        write_buffer_flush(wb);
+        if (n > wb->capacity) {
+            char *grown = (char *)realloc(wb->data, n);
+            if (grown == NULL) {
+                wb->failed = 1;
+                return NULL;
+            }
+            wb->data = grown;
+            wb->capacity = n;
+        }
+    }
+    return wb->failed ? NULL : wb->data + wb->used;
+}
+
+/**
+ * @brief 한 행을 인코딩하여 버퍼에 추가합니다
+ */
+static void write_buffer_row(WriteBuffer *wb, char *const *fields, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        size_t length = strlen(fields[i]);
+        char *out = write_buffer_reserve(wb, CSV_FIELD_ENCODED_MAX(length) + 1);
+        if (out == NULL) {
+            return;
+        }
+        size_t written = csv_field_encode(fields[i], length, out);
+        out[written++] = (i + 1 < count) ? ',' : '\n';
+        wb->used += written;
+    }
+    if (count == 0) {
+        char *out = write_buffer_reserve(wb, 1);
+        if (out != NULL) {
+            *out = '\n';
+            wb->used++;
+        }
+    }
+}
+
 int csv_write(const CSVData *data, const char *filename) {
     if (data == NULL || filename == NULL) {
         return -1;
     }
 
-    FILE *file = fopen(filename, "w");
+    FILE *file = fopen(filename, "wb");
     if (file == NULL) {
         return -1;
     }
 
-    /* 헤더 쓰기 */
-    for (size_t i = 0; i < data->col_count; i++) {
-        fprintf(file, "%s", data->headers[i]);
-        if (i < data->col_count - 1) {
-            fprintf(file, ",");
+    /* 셀마다 fprintf하지 않고 큰 버퍼에 모아 블록 단위로 씀 */
+    WriteBuffer wb;
+    wb.file = file;
+    wb.data = (char *)malloc(WRITE_BUFFER_SIZE);
+    wb.used = 0;
+    wb.capacity = (wb.data != NULL) ? WRITE_BUFFER_SIZE : 0;
+    wb.failed = (wb.data == NULL);
+
+    write_buffer_row(&wb, data->headers, data->col_count);
+    for (size_t i = 0; i < data->row_count && !wb.failed; i++) {
+        write_buffer_row(&wb, data->rows[i], data->col_count);
+    }
+    write_buffer_flush(&wb);
+
+    free(wb.data);
+    if (fclose(file) != 0) {
+        wb.failed = 1;
+    }
+    return wb.failed ? -1 : 0;
+}
+
+/**
+ * @brief csv_save_binary()에서 쓰는 셀 콜백
+ */
+static const char* snapshot_cell(void *user, size_t row, size_t col, size_t *length) {
+    const CSVData *data = (const CSVData *)user;
+    const char *value = data->rows[row][col];
+    *length = strlen(value);
+    return value;
+}
+
+int csv_save_binary(const CSVData *data, const char *filename) {
+    if (data == NULL || filename == NULL) {
+        return -1;
+    }
+
+    CSVSnapshotSource *columns = NULL;
+    if (data->col_count > 0) {
+        columns = (CSVSnapshotSource *)malloc(data->col_count * sizeof(CSVSnapshotSource));
+        if (columns == NULL) {
+            return -1;
         }
     }
-    fprintf(file, "\n");
+    for (size_t i = 0; i < data->col_count; i++) {
+        columns[i].name = data->headers[i];
+        columns[i].name_length = strlen(data->headers[i]);
+        columns[i].type = CSV_SNAPSHOT_STRING;
+        columns[i].values = NULL;
+    }
 
-    /* 데이터 쓰기 */
-    for (size_t i = 0; i < data->row_count; i++) {
-        for (size_t j = 0; j < data->col_count; j++) {
-            fprintf(file, "%s", data->rows[i][j]);
-            if (j < data->col_count - 1) {
-                fprintf(file, ",");
+    int result = csv_snapshot_write(filename, data->row_count, data->col_count,
+                                    columns, snapshot_cell, (void *)data);
+    free(columns);
+    return result;
+}
+
+CSVData* csv_load_binary(const char *filename, int verify_checksum) {
+    if (filename == NULL) {
+        return NULL;
+    }
+
+    size_t size = 0;
+    char *mapping = (char *)csv_snapshot_map(filename, &size);
+    if (mapping == NULL) {
+        return NULL;
+    }
+    if (csv_snapshot_validate(mapping, size, verify_checksum) != 0) {
+        csv_snapshot_unmap(mapping, size);
+        return NULL;
+    }
+
+    CSVData *data = (CSVData *)malloc(sizeof(CSVData));
+    if (data == NULL) {
+        csv_snapshot_unmap(mapping, size);
+        return NULL;
+    }
+    const CSVSnapshotHeader *header = (const CSVSnapshotHeader *)mapping;
+    const CSVSnapshotColumn *columns = (const CSVSnapshotColumn *)(mapping + sizeof(CSVSnapshotHeader));
+    data->rows = NULL;
+    data->row_count = 0;
+    data->col_count = (size_t)header->col_count;
+    csv_arena_init(&data->arena);
+    data->snapshot = mapping;
+    data->snapshot_size = size;
+
+    /* 셀 문자열은 복사하지 않고 매핑을 가리키는 포인터 배열만 만듦 */
+    size_t rows = (size_t)header->row_count;
+    size_t cols = data->col_count;
+    data->headers = (char **)csv_arena_alloc(&data->arena, cols * sizeof(char *), sizeof(char *));
+    data->rows = (char ***)malloc((rows > 0 ? rows : 1) * sizeof(char **));
+    char **cells = (char **)csv_arena_alloc(&data->arena, rows * cols * sizeof(char *), sizeof(char *));
+    if (data->headers == NULL || data->rows == NULL || (cells == NULL && rows * cols > 0)) {
+        csv_destroy(data);
+        return NULL;
+    }
+
+    for (size_t c = 0; c < cols; c++) {
+        data->headers[c] = mapping + columns[c].name_offset;
+    }
+    for (size_t r = 0; r < rows; r++) {
+        data->rows[r] = cells + r * cols;
+    }
+    for (size_t c = 0; c < cols; c++) {
+        char *heap = mapping + columns[c].heap_offset;
+        const uint64_t *offsets = (const uint64_t *)(mapping + columns[c].offsets_offset);
+        const uint32_t *lengths = (const uint32_t *)(mapping + columns[c].lengths_offset);
+        uint64_t heap_size = columns[c].heap_size;
+        for (size_t r = 0; r < rows; r++) {
+            /* 체크섬을 건너뛰어도 힙 밖을 가리키는 셀은 받아들이지 않음 */
+            if (offsets[r] >= heap_size || lengths[r] >= heap_size - offsets[r] ||
+                heap[offsets[r] + lengths[r]] != '\0') {
+                csv_destroy(data);
+                return NULL;
             }
+            cells[r * cols + c] = heap + offsets[r];
         }
-        fprintf(file, "\n");
     }
-
-    fclose(file);
-    return 0;
+    data->row_count = rows;
+    return data;
 }
 
 size_t csv_row_count(const CSVData *data) {
@@ -340,26 +986,10 @@ void csv_destroy(CSVData *data) {
         return;
     }
 
-    /* 헤더 해제 */
-    if (data->headers != NULL) {
-        for (size_t i = 0; i < data->col_count; i++) {
-            free(data->headers[i]);
-        }
-        free(data->headers);
-    }
-
-    /* 데이터 행 해제 */
-    if (data->rows != NULL) {
-        for (size_t i = 0; i < data->row_count; i++) {
-            if (data->rows[i] != NULL) {
-                for (size_t j = 0; j < data->col_count; j++) {
-                    free(data->rows[i][j]);
-                }
-                free(data->rows[i]);
-            }
-        }
-        free(data->rows);
-    }
+    /* 헤더, 행별 필드 배열, 셀 문자열은 아레나 블록 단위로 한꺼번에 해제 */
+    csv_arena_free(&data->arena);
+    free(data->rows);
+    csv_snapshot_unmap(data->snapshot, data->snapshot_size);
 
     /* 구조체 해제 */
     free(data);
@@ -0,0 +1,556 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE  /* struct statx, O_CLOEXEC */
+#endif
+
+#include "mylib/csv_read_files.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * 왜 이렇게?: liburing 없이 커널 헤더만으로 사용
+ * - 필요한 것은 링 매핑과 SQE 몇 종류뿐이라 외부 라이브러리 의존성을 만들지 않음
+ * - IO_URING_OP_SUPPORTED가 있는 헤더(5.6+)에는 OPENAT/STATX/READ/CLOSE와 probe가 모두 있음
+ * - 실행 중인 커널이 지원하는지는 링을 만든 뒤 probe로 다시 확인
+ */
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#ifdef IO_URING_OP_SUPPORTED
+#define CSV_HAVE_IO_URING 1
+#endif
+#endif
+#endif
+
+#ifdef CSV_HAVE_IO_URING
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define READ_CHUNK_MAX (1u << 30)  /* SQE 하나로 요청할 최대 바이트 수 */
+
+/* ===== 일반 읽기 (대체 경로) ===== */
+
+static void read_plain(const char *path, CSVFileBuffer *out) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        out->error = (errno != 0) ? errno : ENOENT;
+        return;
+    }
+
+    long length = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        length = ftell(file);
+    }
+    if (length < 0 || fseek(file, 0, SEEK_SET) != 0) {
+        out->error = (errno != 0) ? errno : EIO;
+        fclose(file);
+        return;
+    }
+
+    out->data = (char *)malloc((size_t)length + 1);
+    if (out->data == NULL) {
+        out->error = ENOMEM;
+        fclose(file);
+        return;
+    }
+    out->size = fread(out->data, 1, (size_t)length, file);
+    if (ferror(file)) {
+        free(out->data);
+        out->data = NULL;
+        out->size = 0;
+        out->error = EIO;
+    } else {
+        out->data[out->size] = '\0';
+    }
+    fclose(file);
+}
+
+/* ===== io_uring ===== */
+
+#ifdef CSV_HAVE_IO_URING
+
+typedef struct {
+    int fd;
+    unsigned entries;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sq_map;
+    size_t sq_map_size;
+    void *cq_map;          /**< IORING_FEAT_SINGLE_MMAP이면 sq_map과 같음 */
+    size_t cq_map_size;
+    size_t sqes_size;
+    unsigned local_tail;   /**< 채웠지만 아직 커널에 알리지 않은 SQ 꼬리 */
+    unsigned submitted;    /**< 커널에 알린 SQ 꼬리 */
+    unsigned pending;      /**< 제출했지만 아직 완료를 거두지 않은 요청 수 */
+} Ring;
+
+static void ring_free(Ring *ring) {
+    if (ring->sqes != NULL) {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_map != NULL && ring->cq_map != ring->sq_map) {
+        munmap(ring->cq_map, ring->cq_map_size);
+    }
+    if (ring->sq_map != NULL) {
+        munmap(ring->sq_map, ring->sq_map_size);
+    }
+    close(ring->fd);
+}
+
+/* 이 커널이 필요한 연산을 모두 지원하는지 확인 */
+static int ring_supports_ops(const Ring *ring) {
+    static const unsigned char needed[] = { IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_CLOSE };
+    const unsigned op_count = 256;
+    size_t size = sizeof(struct io_uring_probe) + op_count * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = (struct io_uring_probe *)calloc(1, size);
+    if (probe == NULL) {
+        return 0;
+    }
+
+    int supported = (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_PROBE, probe, op_count) == 0);
+    for (size_t i = 0; supported && i < sizeof(needed); i++) {
+        supported = (needed[i] <= probe->last_op) && (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+    }
+    free(probe);
+    return supported;
+}
+
+static int ring_init(Ring *ring, unsigned entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    memset(ring, 0, sizeof(*ring));
+
+    ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0) {
+        return -1;
+    }
+    ring->entries = params.sq_entries;
+
+    ring->sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    int single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single && ring->cq_map_size > ring->sq_map_size) {
+        ring->sq_map_size = ring->cq_map_size;
+    }
+
+    void *sq = mmap(NULL, ring->sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    ring->fd, IORING_OFF_SQ_RING);
+    if (sq == MAP_FAILED) {
+        close(ring->fd);
+        return -1;
+    }
+    ring->sq_map = sq;
+
+    if (single) {
+        ring->cq_map = sq;
+    } else {
+        void *cq = mmap(NULL, ring->cq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring->fd, IORING_OFF_CQ_RING);
+        if (cq == MAP_FAILED) {
+            ring_free(ring);
+            return -1;
+        }
+        ring->cq_map = cq;
+    }
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    void *sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring->fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        ring_free(ring);
+        return -1;
+    }
+    ring->sqes = (struct io_uring_sqe *)sqes;
+
+    char *sq_base = (char *)ring->sq_map;
+    char *cq_base = (char *)ring->cq_map;
+    ring->sq_head = (unsigned *)(sq_base + params.sq_off.head);
+    ring->sq_tail = (unsigned *)(sq_base + params.sq_off.tail);
+    ring->sq_mask = (unsigned *)(sq_base + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)(sq_base + params.sq_off.array);
+    ring->cq_head = (unsigned *)(cq_base + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(cq_base + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)(cq_base + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq_base + params.cq_off.cqes);
+    ring->local_tail = *ring->sq_tail;
+    ring->submitted = ring->local_tail;
+
+    if (!ring_supports_ops(ring)) {
+        ring_free(ring);
+        return -1;
+    }
+    return 0;
+}
+
+/* 다음 SQE를 0으로 채워 돌려줌 (각 단계의 SQE 수는 링 크기 이하로 맞춰 둠) */
+static struct io_uring_sqe* ring_sqe(Ring *ring, uint64_t user_data) {
+    unsigned index = ring->local_tail & *ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->user_data = user_data;
+    ring->sq_array[index] = index;
+    ring->local_tail++;
+    return sqe;
+}
+
+/**
+ * @brief 완료 하나를 처리하는 콜백
+ * @return 새로 채운 SQE 수 (짧은 읽기의 이어 읽기 등)
+ */
+typedef unsigned (*CompletionFn)(Ring *ring, void *ctx, uint64_t user_data, int res);
+
+/**
+ * @brief 도착한 완료를 모두 거둡니다
+ * @param completed 거둔 완료 수를 더할 곳
+ * @return 콜백이 새로 채운 SQE 수의 합
+ */
+static unsigned ring_reap(Ring *ring, CompletionFn on_complete, void *ctx, unsigned *completed) {
+    unsigned added = 0;
+    unsigned head = *ring->cq_head;
+    unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++) {
+        const struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+        added += on_complete(ring, ctx, cqe->user_data, cqe->res);
+        ring->pending--;
+        (*completed)++;
+    }
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    return added;
+}
+
+/**
+ * @brief 채운 SQE를 제출하고, expected개(+콜백이 추가한 만큼)가 모두 완료될 때까지 처리합니다
+ * @return 성공 시 0, io_uring_enter 실패 시 -1 (이미 제출한 요청이 남아 있을 수 있으므로 ring_drain() 필요)
+ */
+static int ring_run(Ring *ring, unsigned expected, CompletionFn on_complete, void *ctx) {
+    unsigned completed = 0;
+    while (completed < expected) {
+        unsigned to_submit = ring->local_tail - ring->submitted;
+        __atomic_store_n(ring->sq_tail, ring->local_tail, __ATOMIC_RELEASE);
+        long ret = syscall(__NR_io_uring_enter, ring->fd, to_submit, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        ring->submitted += (unsigned)ret;
+        ring->pending += (unsigned)ret;
+        expected += ring_reap(ring, on_complete, ctx, &completed);
+    }
+    return 0;
+}
+
+/**
+ * @brief 제출한 요청이 모두 끝날 때까지 기다립니다 (새 SQE는 제출하지 않음)
+ * @return 성공 시 0, 기다리기 실패 시 -1 (커널이 아직 버퍼에 쓸 수 있음)
+ *
+ * @note 실패한 묶음의 버퍼를 해제하기 전에 호출합니다. 진행 중인 READ/STATX가
+ *       해제된 메모리에 쓰지 않도록 완료를 모두 거둔 뒤에야 버퍼를 돌려줄 수 있습니다.
+ */
+static int ring_drain(Ring *ring, CompletionFn on_complete, void *ctx) {
+    unsigned completed = 0;
+    while (ring->pending > 0) {
+        long ret = syscall(__NR_io_uring_enter, ring->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+        if (ret < 0 && errno != EINTR) {
+            return -1;
+        }
+        ring_reap(ring, on_complete, ctx, &completed);
+    }
+    return 0;
+}
+
+typedef struct {
+    const char *const *paths;
+    CSVFileBuffer *out;
+    int *fds;
+    struct statx *stats;
+    size_t *done;
+} Batch;
+
+static unsigned on_open_or_stat(Ring *ring, void *ctx, uint64_t user_data, int res) {
+    (void)ring;
+    Batch *batch = (Batch *)ctx;
+    size_t i = (size_t)(user_data >> 1);
+    if (res < 0 && batch->out[i].error == 0) {
+        batch->out[i].error = -res;
+    }
+    if ((user_data & 1) == 0) {
+        batch->fds[i] = res;
+    }
+    return 0;
+}
+
+static void queue_read(Ring *ring, Batch *batch, size_t i) {
+    size_t remaining = batch->out[i].size - batch->done[i];
+    struct io_uring_sqe *sqe = ring_sqe(ring, i);
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = batch->fds[i];
+    sqe->addr = (uint64_t)(uintptr_t)(batch->out[i].data + batch->done[i]);
+    sqe->len = (remaining > READ_CHUNK_MAX) ? READ_CHUNK_MAX : (unsigned)remaining;
+    sqe->off = batch->done[i];
+}
+
+static unsigned on_read(Ring *ring, void *ctx, uint64_t user_data, int res) {
+    Batch *batch = (Batch *)ctx;
+    size_t i = (size_t)user_data;
+    CSVFileBuffer *out = &batch->out[i];
+    if (res < 0) {
+        out->error = -res;
+        return 0;
+    }
+    if (res == 0) {
+        out->size = batch->done[i];  /* 크기를 잰 뒤 파일이 줄어듦 */
+        return 0;
+    }
+    batch->done[i] += (size_t)res;
+    if (batch->done[i] < out->size) {
+        queue_read(ring, batch, i);  /* 짧은 읽기: 나머지를 이어서 */
+        return 1;
+    }
+    return 0;
+}
+
+/* 결과를 쓰지 않는 완료 (닫기, 실패한 묶음의 남은 읽기) */
+static unsigned on_ignore(Ring *ring, void *ctx, uint64_t user_data, int res) {
+    (void)ring;
+    (void)ctx;
+    (void)user_data;
+    (void)res;
+    return 0;
+}
+
+/* 실패한 파일의 버퍼는 버리고, 성공한 파일은 NUL로 끝냄 */
+static void finalize_results(CSVFileBuffer *out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (out[i].error != 0) {
+            free(out[i].data);
+            out[i].data = NULL;
+            out[i].size = 0;
+        } else {
+            out[i].data[out[i].size] = '\0';
+        }
+    }
+}
+
+static void reset_results(CSVFileBuffer *out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        free(out[i].data);
+        out[i].data = NULL;
+        out[i].size = 0;
+        out[i].error = 0;
+    }
+}
+
+/**
+ * @brief 파일 count개(링 크기의 절반 이하)를 세 번의 제출로 읽습니다
+ *
+ * 1단계: 파일마다 OPENAT + STATX(경로 기준)를 한꺼번에 제출
+ * 2단계: 크기만큼 버퍼를 잡고 READ를 한꺼번에 제출 (짧은 읽기는 이어서 제출)
+ * 3단계: CLOSE를 한꺼번에 제출
+ *
+ * @return 성공 시 0, 결과는 유효하지만 닫기 완료를 거두지 못해 링을 더 쓸 수 없으면 1,
+ *         링이 실패하면 -1 (out은 비운 상태로 되돌림)
+ */
+static int read_batch(Ring *ring, const char *const *paths, CSVFileBuffer *out, size_t count) {
+    int fds[CSV_READ_FILES_BATCH];
+    size_t done[CSV_READ_FILES_BATCH];
+    /* 커널이 비동기로 쓰므로 힙에 둠 (완료를 못 거두면 스택 대신 이것을 버림) */
+    struct statx *stats = (struct statx *)malloc(count * sizeof(struct statx));
+    if (stats == NULL) {
+        return -1;
+    }
+    Batch batch = { paths, out, fds, stats, done };
+
+    unsigned queued = 0;
+    for (size_t i = 0; i < count; i++) {
+        fds[i] = -1;
+        done[i] = 0;
+        if (paths[i] == NULL) {
+            out[i].error = EINVAL;
+            continue;
+        }
+        struct io_uring_sqe *sqe = ring_sqe(ring, (uint64_t)i << 1);
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (uint64_t)(uintptr_t)paths[i];
+        sqe->open_flags = O_RDONLY | O_CLOEXEC;
+
+        sqe = ring_sqe(ring, ((uint64_t)i << 1) | 1);
+        sqe->opcode = IORING_OP_STATX;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (uint64_t)(uintptr_t)paths[i];
+        sqe->len = STATX_SIZE;
+        sqe->off = (uint64_t)(uintptr_t)&stats[i];
+        queued += 2;
+    }
+    /* 실패하면 남은 열기 완료도 fds에 받아 닫을 수 있도록 같은 콜백으로 거둠 */
+    CompletionFn drain_fn = on_open_or_stat;
+    int failed = (ring_run(ring, queued, on_open_or_stat, &batch) != 0);
+
+    queued = 0;
+    for (size_t i = 0; !failed && i < count; i++) {
+        if (out[i].error != 0) {
+            continue;
+        }
+        out[i].size = (size_t)stats[i].stx_size;
+        out[i].data = (char *)malloc(out[i].size + 1);
+        if (out[i].data == NULL) {
+            out[i].error = ENOMEM;
+            continue;
+        }
+        if (out[i].size > 0) {
+            queue_read(ring, &batch, i);
+            queued++;
+        }
+    }
+    if (!failed) {
+        drain_fn = on_ignore;
+        failed = (ring_run(ring, queued, on_read, &batch) != 0);
+    }
+
+    if (failed) {
+        /* 진행 중인 READ/STATX가 끝나기 전에는 버퍼를 해제할 수 없음 */
+        int drained = (ring_drain(ring, drain_fn, &batch) == 0);
+        for (size_t i = 0; i < count; i++) {
+            if (fds[i] >= 0) {
+                close(fds[i]);  /* 진행 중인 요청은 파일 참조를 따로 잡으므로 닫아도 안전 */
+            }
+        }
+        if (drained) {
+            reset_results(out, count);
+            free(stats);
+        } else {
+            /* 커널이 아직 쓸 수 있으므로 해제하지 않고 버림 (누수가 해제 후 쓰기보다 나음) */
+            for (size_t i = 0; i < count; i++) {
+                out[i].data = NULL;
+            }
+            reset_results(out, count);
+        }
+        return -1;
+    }
+
+    queued = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (fds[i] < 0) {
+            continue;
+        }
+        struct io_uring_sqe *sqe = ring_sqe(ring, i);
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = fds[i];
+        queued++;
+    }
+    free(stats);
+    /* 읽기는 끝났으므로 결과는 유효함. 닫기 제출이 실패하면 어떤 fd가 닫혔는지
+       알 수 없어 다시 닫지 않음 (이중 close로 다른 fd를 닫는 것보다 누수가 나음).
+       남은 닫기 완료를 다음 묶음이 잘못 거두지 않도록 다 거두고, 못 거두면 링을 그만 씀 */
+    if (ring_run(ring, queued, on_ignore, &batch) != 0 && ring_drain(ring, on_ignore, &batch) != 0) {
+        finalize_results(out, count);
+        return 1;
+    }
+
+    finalize_results(out, count);
+    return 0;
+}
+
+static int g_uring_state = 0;  /* 0: 모름, 1: 사용 가능, -1: 불가 */
+
+static int uring_available(void) {
+    int state = __atomic_load_n(&g_uring_state, __ATOMIC_RELAXED);
+    if (state == 0) {
+        Ring ring;
+        state = (ring_init(&ring, 2) == 0) ? 1 : -1;
+        if (state == 1) {
+            ring_free(&ring);
+        }
+        __atomic_store_n(&g_uring_state, state, __ATOMIC_RELAXED);
+    }
+    return state == 1;
+}
+
+#endif /* CSV_HAVE_IO_URING */
+
+/* ===== 공개 함수 ===== */
+
+int csv_read_files(const char *const *paths, size_t count, CSVFileBuffer *out, int flags) {
+    if (count > 0 && (paths == NULL || out == NULL)) {
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i].data = NULL;
+        out[i].size = 0;
+        out[i].error = 0;
+    }
+
+    size_t next = 0;
+#ifdef CSV_HAVE_IO_URING
+    Ring ring;
+    if (flags != CSV_READ_PLAIN && count > 1 && uring_available() &&
+        ring_init(&ring, 2 * CSV_READ_FILES_BATCH) == 0) {
+        while (next < count) {
+            size_t n = count - next;
+            if (n > CSV_READ_FILES_BATCH) {
+                n = CSV_READ_FILES_BATCH;
+            }
+            int status = read_batch(&ring, paths + next, out + next, n);
+            if (status < 0) {
+                break;  /* 남은 파일은 일반 읽기로 */
+            }
+            next += n;
+            if (status > 0) {
+                break;
+            }
+        }
+        ring_free(&ring);
+    }
+#else
+    (void)flags;
+#endif
+
+    for (; next < count; next++) {
+        if (paths[next] == NULL) {
+            out[next].error = EINVAL;
+        } else {
+            read_plain(paths[next], &out[next]);
+        }
+    }
+
+    int failed = 0;
+    for (size_t i = 0; i < count; i++) {
+        failed += (out[i].error != 0);
+    }
+    return failed;
+}
+
+void csv_file_buffers_free(CSVFileBuffer *buffers, size_t count) {
+    if (buffers == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        free(buffers[i].data);
+        buffers[i].data = NULL;
+        buffers[i].size = 0;
+    }
+}
+
+const char* csv_read_files_backend(void) {
+#ifdef CSV_HAVE_IO_URING
+    if (uring_available()) {
+        return "io_uring";
+    }
+#endif
+    return "plain";
+}
@@ -0,0 +1,424 @@
+#include "mylib/csv_readahead.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#define READAHEAD_DEFAULT_BLOCK (1024 * 1024)
+#define READAHEAD_MIN_DEPTH 2
+
+/* ===== 플랫폼 계층 (파일, 잠금, 스레드, 시계) ===== */
+
+#ifdef _WIN32
+typedef HANDLE FileHandle;
+typedef CRITICAL_SECTION Mutex;
+typedef CONDITION_VARIABLE Cond;
+typedef HANDLE Thread;
+#define INVALID_FILE INVALID_HANDLE_VALUE
+#else
+typedef int FileHandle;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t Cond;
+typedef pthread_t Thread;
+#define INVALID_FILE (-1)
+#endif
+
+struct CSVReadAhead {
+    FileHandle file;
+    uint64_t file_size;
+    uint64_t file_offset;     /**< 다음에 읽을 파일 위치 (생산자만 사용) */
+
+    char *blocks;             /**< depth × block_size 링 */
+    size_t *lengths;          /**< 블록별 채운 바이트 수 */
+    size_t block_size;
+    size_t depth;
+    size_t head;              /**< 소비자가 읽는 블록 */
+    size_t tail;              /**< 생산자가 채울 블록 */
+    size_t filled;            /**< 채워졌지만 아직 다 읽지 않은 블록 수 */
+    size_t read_pos;          /**< head 블록 안의 읽은 위치 (소비자만 사용) */
+
+    int done;                 /**< 생산자가 파일 끝에 닿았거나 실패함 */
+    int error;
+    int stop;                 /**< 닫는 중: 생산자 종료 요청 */
+
+    int threaded;
+    Thread thread;
+    Mutex lock;
+    Cond not_empty;           /**< 소비자 대기: 채워진 블록이 생김 */
+    Cond not_full;            /**< 생산자 대기: 빈 블록이 생김 */
+
+    uint64_t bytes_read;
+    uint64_t blocks_read;
+    uint64_t producer_stall_ns;
+    uint64_t consumer_stall_ns;
+};
+
+#ifdef _WIN32
+
+static FileHandle file_open(const char *filename, uint64_t *size) {
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    LARGE_INTEGER file_size;
+    if (file != INVALID_HANDLE_VALUE && !GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        return INVALID_HANDLE_VALUE;
+    }
+    if (file != INVALID_HANDLE_VALUE) {
+        *size = (uint64_t)file_size.QuadPart;
+    }
+    return file;
+}
+
+static void file_close(FileHandle file) {
+    CloseHandle(file);
+}
+
+/* 위치 지정 읽기 (파일 포인터를 공유하지 않음) */
+static long long file_pread(FileHandle file, char *dst, size_t size, uint64_t offset) {
+    OVERLAPPED overlapped;
+    DWORD n = 0;
+    memset(&overlapped, 0, sizeof(overlapped));
+    overlapped.Offset = (DWORD)offset;
+    overlapped.OffsetHigh = (DWORD)(offset >> 32);
+    DWORD request = (size > 0x40000000u) ? 0x40000000u : (DWORD)size;
+    if (!ReadFile(file, dst, request, &n, &overlapped)) {
+        return (GetLastError() == ERROR_HANDLE_EOF) ? 0 : -1;
+    }
+    return (long long)n;
+}
+
+static uint64_t now_ns(void) {
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+}
+
+static void mutex_init(Mutex *m) { InitializeCriticalSection(m); }
+static void mutex_destroy(Mutex *m) { DeleteCriticalSection(m); }
+static void mutex_lock(Mutex *m) { EnterCriticalSection(m); }
+static void mutex_unlock(Mutex *m) { LeaveCriticalSection(m); }
+static void cond_init(Cond *c) { InitializeConditionVariable(c); }
+static void cond_destroy(Cond *c) { (void)c; }
+static void cond_wait(Cond *c, Mutex *m) { SleepConditionVariableCS(c, m, INFINITE); }
+static void cond_signal(Cond *c) { WakeConditionVariable(c); }
+
+static void producer_loop(CSVReadAhead *reader);
+
+static DWORD WINAPI producer_entry(LPVOID param) {
+    producer_loop((CSVReadAhead *)param);
+    return 0;
+}
+
+static int thread_start(CSVReadAhead *reader) {
+    reader->thread = CreateThread(NULL, 0, producer_entry, reader, 0, NULL);
+    return (reader->thread != NULL) ? 0 : -1;
+}
+
+static void thread_join(Thread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+#else
+
+static FileHandle file_open(const char *filename, uint64_t *size) {
+    int fd = open(filename, O_RDONLY);
+    struct stat st;
+    if (fd >= 0 && fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+    if (fd >= 0) {
+        *size = (uint64_t)st.st_size;
+#ifdef POSIX_FADV_SEQUENTIAL
+        /* 커널 read-ahead 창을 키움 (실패해도 읽기에는 영향 없음) */
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    }
+    return fd;
+}
+
+static void file_close(FileHandle file) {
+    close(file);
+}
+
+static long long file_pread(FileHandle file, char *dst, size_t size, uint64_t offset) {
+    ssize_t n;
+    do {
+        n = pread(file, dst, size, (off_t)offset);
+    } while (n < 0 && errno == EINTR);
+    return (long long)n;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void mutex_init(Mutex *m) { pthread_mutex_init(m, NULL); }
+static void mutex_destroy(Mutex *m) { pthread_mutex_destroy(m); }
+static void mutex_lock(Mutex *m) { pthread_mutex_lock(m); }
+static void mutex_unlock(Mutex *m) { pthread_mutex_unlock(m); }
+static void cond_init(Cond *c) { pthread_cond_init(c, NULL); }
+static void cond_destroy(Cond *c) { pthread_cond_destroy(c); }
+static void cond_wait(Cond *c, Mutex *m) { pthread_cond_wait(c, m); }
+static void cond_signal(Cond *c) { pthread_cond_signal(c); }
+
+static void producer_loop(CSVReadAhead *reader);
+
+static void* producer_entry(void *param) {
+    producer_loop((CSVReadAhead *)param);
+    return NULL;
+}
+
+static int thread_start(CSVReadAhead *reader) {
+    return (pthread_create(&reader->thread, NULL, producer_entry, reader) == 0) ? 0 : -1;
+}
+
+static void thread_join(Thread thread) {
+    pthread_join(thread, NULL);
+}
+
+#endif
+
+/* ===== 생산자 ===== */
+
+/**
+ * @brief dst를 가득 채우거나 파일 끝까지 읽습니다
+ * @return 읽은 바이트 수, 실패 시 -1
+ */
+static long long read_full(CSVReadAhead *reader, char *dst, size_t size, uint64_t offset) {
+    size_t total = 0;
+    while (total < size) {
+        long long n = file_pread(reader->file, dst + total, size - total, offset + total);
+        if (n < 0) {
+            return -1;
+        }
+        if (n == 0) {
+            break;
+        }
+        total += (size_t)n;
+    }
+    return (long long)total;
+}
+
+/*
+ * 왜 이렇게?: 링의 블록은 항상 한쪽만 만짐
+ * - 생산자는 tail 블록을 잠금 밖에서 채우고, filled가 depth보다 작을 때만 tail을 고름
+ * - 소비자는 head 블록을 잠금 밖에서 읽고, filled > 0일 때만 head를 고름
+ * - 잠금은 인덱스와 개수를 옮길 때만 잡으므로 pread와 파싱이 실제로 겹침
+ */
+static void producer_loop(CSVReadAhead *reader) {
+    mutex_lock(&reader->lock);
+    for (;;) {
+        while (reader->filled == reader->depth && !reader->stop) {
+            uint64_t start = now_ns();
+            cond_wait(&reader->not_full, &reader->lock);
+            reader->producer_stall_ns += now_ns() - start;
+        }
+        if (reader->stop) {
+            break;
+        }
+        size_t slot = reader->tail;
+        uint64_t offset = reader->file_offset;
+        mutex_unlock(&reader->lock);
+
+        long long n = read_full(reader, reader->blocks + slot * reader->block_size, reader->block_size, offset);
+
+        mutex_lock(&reader->lock);
+        if (n < 0) {
+            reader->error = 1;
+            reader->done = 1;
+        } else {
+            reader->lengths[slot] = (size_t)n;
+            reader->file_offset += (uint64_t)n;
+            reader->bytes_read += (uint64_t)n;
+            if (n > 0) {
+                reader->tail = (reader->tail + 1) % reader->depth;
+                reader->filled++;
+                reader->blocks_read++;
+            }
+            if ((size_t)n < reader->block_size) {
+                reader->done = 1;
+            }
+        }
+        cond_signal(&reader->not_empty);
+        if (reader->done) {
+            break;
+        }
+    }
+    mutex_unlock(&reader->lock);
+}
+
+/* ===== 공개 함수 ===== */
+
+CSVReadAhead* csv_readahead_open(const char *filename, size_t block_size, size_t depth) {
+    if (filename == NULL) {
+        return NULL;
+    }
+    if (block_size == 0) {
+        block_size = READAHEAD_DEFAULT_BLOCK;
+    }
+    if (depth < READAHEAD_MIN_DEPTH) {
+        depth = READAHEAD_MIN_DEPTH;
+    }
+
+    CSVReadAhead *reader = (CSVReadAhead *)calloc(1, sizeof(CSVReadAhead));
+    if (reader == NULL) {
+        return NULL;
+    }
+    reader->file = file_open(filename, &reader->file_size);
+    if (reader->file == INVALID_FILE) {
+        free(reader);
+        return NULL;
+    }
+    reader->block_size = block_size;
+    reader->depth = depth;
+
+    /* 블록 하나에 다 들어가는 파일은 겹칠 것이 없으므로 링 없이 바로 읽음 */
+    if (reader->file_size <= block_size) {
+        return reader;
+    }
+
+    reader->blocks = (char *)malloc(depth * block_size);
+    reader->lengths = (size_t *)calloc(depth, sizeof(size_t));
+    if (reader->blocks == NULL || reader->lengths == NULL) {
+        free(reader->blocks);
+        free(reader->lengths);
+        reader->blocks = NULL;
+        reader->lengths = NULL;
+        return reader;  /* 메모리가 부족하면 동기 읽기로 */
+    }
+
+    mutex_init(&reader->lock);
+    cond_init(&reader->not_empty);
+    cond_init(&reader->not_full);
+    if (thread_start(reader) == 0) {
+        reader->threaded = 1;
+    } else {
+        cond_destroy(&reader->not_full);
+        cond_destroy(&reader->not_empty);
+        mutex_destroy(&reader->lock);
+    }
+    return reader;
+}
+
+/* 생산자 없이 호출한 스레드에서 바로 읽음 (읽는 시간은 소비자 대기로 셈) */
+static size_t read_direct(CSVReadAhead *reader, char *dst, size_t size) {
+    uint64_t start = now_ns();
+    long long n = read_full(reader, dst, size, reader->file_offset);
+    reader->consumer_stall_ns += now_ns() - start;
+    if (n < 0) {
+        reader->error = 1;
+        return 0;
+    }
+    reader->file_offset += (uint64_t)n;
+    reader->bytes_read += (uint64_t)n;
+    reader->blocks_read += (n > 0);
+    return (size_t)n;
+}
+
+size_t csv_readahead_read(CSVReadAhead *reader, void *dst, size_t size) {
+    if (reader == NULL || dst == NULL) {
+        return 0;
+    }
+    if (!reader->threaded) {
+        return reader->error ? 0 : read_direct(reader, (char *)dst, size);
+    }
+
+    char *out = (char *)dst;
+    size_t copied = 0;
+    while (copied < size) {
+        mutex_lock(&reader->lock);
+        while (reader->filled == 0 && !reader->done) {
+            uint64_t start = now_ns();
+            cond_wait(&reader->not_empty, &reader->lock);
+            reader->consumer_stall_ns += now_ns() - start;
+        }
+        if (reader->filled == 0) {
+            mutex_unlock(&reader->lock);
+            break;  /* 파일 끝 또는 오류 */
+        }
+        size_t slot = reader->head;
+        size_t available = reader->lengths[slot] - reader->read_pos;
+        mutex_unlock(&reader->lock);
+
+        size_t take = (available < size - copied) ? available : size - copied;
+        memcpy(out + copied, reader->blocks + slot * reader->block_size + reader->read_pos, take);
+        reader->read_pos += take;
+        copied += take;
+
+        if (reader->read_pos == reader->lengths[slot]) {
+            mutex_lock(&reader->lock);
+            reader->head = (reader->head + 1) % reader->depth;
+            reader->filled--;
+            reader->read_pos = 0;
+            cond_signal(&reader->not_full);
+            mutex_unlock(&reader->lock);
+        }
+    }
+    return copied;
+}
+
+int csv_readahead_error(const CSVReadAhead *reader) {
+    return (reader == NULL) ? 1 : reader->error;
+}
+
+void csv_readahead_stats(const CSVReadAhead *reader, CSVReadAheadStats *stats) {
+    if (stats == NULL) {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    if (reader == NULL) {
+        return;
+    }
+
+    CSVReadAhead *mutable_reader = (CSVReadAhead *)reader;
+    if (reader->threaded) {
+        mutex_lock(&mutable_reader->lock);
+    }
+    stats->bytes_read = reader->bytes_read;
+    stats->blocks_read = reader->blocks_read;
+    stats->producer_stall_ns = reader->producer_stall_ns;
+    stats->consumer_stall_ns = reader->consumer_stall_ns;
+    stats->threaded = reader->threaded;
+    if (reader->threaded) {
+        mutex_unlock(&mutable_reader->lock);
+    }
+}
+
+void csv_readahead_close(CSVReadAhead *reader) {
+    if (reader == NULL) {
+        return;
+    }
+
+    if (reader->threaded) {
+        mutex_lock(&reader->lock);
+        reader->stop = 1;
+        cond_signal(&reader->not_full);
+        mutex_unlock(&reader->lock);
+        thread_join(reader->thread);
+
+        cond_destroy(&reader->not_full);
+        cond_destroy(&reader->not_empty);
+        mutex_destroy(&reader->lock);
+    }
+    file_close(reader->file);
+    free(reader->blocks);
+    free(reader->lengths);
+    free(reader);
+}
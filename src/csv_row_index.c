@@ -0,0 +1,125 @@
+#include "mylib/csv_row_index.h"
+#include "mylib/csv_snapshot.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+/**
+ * @brief 오프셋 개수 (row_count를 stride로 올림 나눗셈)
+ */
+static uint64_t offset_count(const CSVRowIndexHeader *header) {
+    return header->row_count / header->stride + (header->row_count % header->stride != 0);
+}
+
+/**
+ * @brief 머리(체크섬 필드 제외)와 오프셋 배열의 체크섬
+ *
+ * 오프셋 배열의 체크섬을 머리의 체크섬 자리에 넣고 머리 전체를 다시 체크섬합니다.
+ */
+static uint64_t index_checksum(const CSVRowIndexHeader *header, const uint64_t *offsets) {
+    CSVRowIndexHeader copy = *header;
+    copy.checksum = csv_snapshot_checksum(offsets, (size_t)offset_count(header) * sizeof(uint64_t));
+    return csv_snapshot_checksum(&copy, sizeof(copy));
+}
+
+int csv_row_index_fingerprint(const char *filename, uint64_t *size, uint64_t *mtime) {
+    if (filename == NULL || size == NULL || mtime == NULL) {
+        return -1;
+    }
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA info;
+    if (!GetFileAttributesExA(filename, GetFileExInfoStandard, &info)) {
+        return -1;
+    }
+    *size = ((uint64_t)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+    /* FILETIME은 100나노초 단위 */
+    *mtime = (((uint64_t)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime) * 100;
+#else
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        return -1;
+    }
+    *size = (uint64_t)st.st_size;
+#ifdef __APPLE__
+    *mtime = (uint64_t)st.st_mtimespec.tv_sec * 1000000000ULL + (uint64_t)st.st_mtimespec.tv_nsec;
+#else
+    *mtime = (uint64_t)st.st_mtim.tv_sec * 1000000000ULL + (uint64_t)st.st_mtim.tv_nsec;
+#endif
+#endif
+    return 0;
+}
+
+int csv_row_index_write(const char *filename, const CSVRowIndexHeader *header, const uint64_t *offsets) {
+    if (filename == NULL || header == NULL || header->stride == 0) {
+        return -1;
+    }
+    uint64_t count = offset_count(header);
+    if (count > 0 && offsets == NULL) {
+        return -1;
+    }
+
+    CSVRowIndexHeader out = *header;
+    memset(out.magic, 0, sizeof(out.magic));
+    memcpy(out.magic, CSV_ROW_INDEX_MAGIC, sizeof(CSV_ROW_INDEX_MAGIC));
+    out.version = CSV_ROW_INDEX_VERSION;
+    out.byte_order = CSV_ROW_INDEX_BYTE_ORDER;
+    out.checksum = index_checksum(&out, offsets);
+
+    FILE *file = fopen(filename, "wb");
+    if (file == NULL) {
+        return -1;
+    }
+    int failed = fwrite(&out, sizeof(out), 1, file) != 1;
+    if (!failed && count > 0) {
+        failed = fwrite(offsets, sizeof(uint64_t), (size_t)count, file) != (size_t)count;
+    }
+    if (fclose(file) != 0) {
+        failed = 1;
+    }
+    if (failed) {
+        remove(filename);
+        return -1;
+    }
+    return 0;
+}
+
+int csv_row_index_validate(const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    if (data == NULL || size < sizeof(CSVRowIndexHeader)) {
+        return -1;
+    }
+
+    CSVRowIndexHeader header;
+    memcpy(&header, bytes, sizeof(header));
+    if (memcmp(header.magic, CSV_ROW_INDEX_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != CSV_ROW_INDEX_VERSION ||
+        header.byte_order != CSV_ROW_INDEX_BYTE_ORDER ||
+        header.stride == 0 ||
+        header.data_begin > header.source_size) {
+        return -1;
+    }
+    uint64_t count = offset_count(&header);
+    if (count > (size - sizeof(header)) / sizeof(uint64_t) ||
+        sizeof(header) + count * sizeof(uint64_t) != size) {
+        return -1;
+    }
+
+    const uint64_t *offsets = (const uint64_t *)(bytes + sizeof(header));
+    if (index_checksum(&header, offsets) != header.checksum) {
+        return -1;
+    }
+    /* 체크섬이 맞아도 오프셋이 원본 범위 안에서 증가하는지 확인 (악의적으로 만든 파일 대비) */
+    uint64_t previous = header.data_begin;
+    for (uint64_t i = 0; i < count; i++) {
+        if (offsets[i] < previous || offsets[i] >= header.source_size || (i > 0 && offsets[i] == previous)) {
+            return -1;
+        }
+        previous = offsets[i];
+    }
+    return 0;
+}
@@ -0,0 +1,392 @@
+#include "mylib/csv_snapshot.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define SNAPSHOT_ALIGN 8
+#define SNAPSHOT_IO_BUFFER (1024 * 1024)
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+static uint64_t checksum_update(uint64_t hash, const unsigned char *bytes, size_t len) {
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, 8);
+        hash = (hash ^ word) * FNV_PRIME;
+    }
+    for (; i < len; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+uint64_t csv_snapshot_checksum(const void *data, size_t len) {
+    return checksum_update(FNV_OFFSET, (const unsigned char *)data, len);
+}
+
+static uint64_t align_up(uint64_t value) {
+    return (value + (SNAPSHOT_ALIGN - 1)) & ~(uint64_t)(SNAPSHOT_ALIGN - 1);
+}
+
+/**
+ * @brief 머리와 열 목록의 체크섬 (머리의 체크섬 필드는 0으로 봄)
+ */
+static uint64_t directory_checksum(const CSVSnapshotHeader *header,
+                                   const CSVSnapshotColumn *columns, size_t col_count) {
+    CSVSnapshotHeader copy = *header;
+    copy.directory_checksum = 0;
+    copy.payload_checksum = 0;
+    uint64_t hash = checksum_update(FNV_OFFSET, (const unsigned char *)&copy, sizeof(copy));
+    return checksum_update(hash, (const unsigned char *)columns, col_count * sizeof(CSVSnapshotColumn));
+}
+
+/* ===== 쓰기 ===== */
+
+/**
+ * @brief 본문 체크섬을 계산하면서 쓰는 출력 (8바이트 단위 체크섬을 위해 끝자리를 모아 둠)
+ */
+typedef struct {
+    FILE *file;
+    uint64_t hash;
+    unsigned char carry[8];
+    size_t carry_len;
+    uint64_t position;
+    int failed;
+} SnapshotOutput;
+
+static void output_write(SnapshotOutput *out, const void *data, size_t len) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    if (len == 0 || out->failed) {
+        return;
+    }
+    if (fwrite(bytes, 1, len, out->file) != len) {
+        out->failed = 1;
+        return;
+    }
+    out->position += len;
+
+    if (out->carry_len > 0) {
+        size_t take = 8 - out->carry_len;
+        if (take > len) {
+            take = len;
+        }
+        memcpy(out->carry + out->carry_len, bytes, take);
+        out->carry_len += take;
+        bytes += take;
+        len -= take;
+        if (out->carry_len < 8) {
+            return;
+        }
+        out->hash = checksum_update(out->hash, out->carry, 8);
+        out->carry_len = 0;
+    }
+
+    size_t whole = len & ~(size_t)7;
+    out->hash = checksum_update(out->hash, bytes, whole);
+    memcpy(out->carry, bytes + whole, len - whole);
+    out->carry_len = len - whole;
+}
+
+static void output_pad(SnapshotOutput *out) {
+    static const char zeros[SNAPSHOT_ALIGN] = {0};
+    output_write(out, zeros, (size_t)(align_up(out->position) - out->position));
+}
+
+static uint64_t output_finish(SnapshotOutput *out) {
+    return checksum_update(out->hash, out->carry, out->carry_len);
+}
+
+int csv_snapshot_write(const char *filename, size_t row_count, size_t col_count,
+                       const CSVSnapshotSource *columns, CSVSnapshotCellFn cell, void *user) {
+    if (filename == NULL || (col_count > 0 && (columns == NULL || cell == NULL))) {
+        return -1;
+    }
+
+    CSVSnapshotColumn *directory = NULL;
+    if (col_count > 0) {
+        directory = (CSVSnapshotColumn *)calloc(col_count, sizeof(CSVSnapshotColumn));
+        if (directory == NULL) {
+            return -1;
+        }
+    }
+
+    /* 배치 계산: 이름, 그다음 열마다 힙/오프셋/길이/값 */
+    uint64_t position = sizeof(CSVSnapshotHeader) + (uint64_t)col_count * sizeof(CSVSnapshotColumn);
+    for (size_t c = 0; c < col_count; c++) {
+        directory[c].name_offset = position;
+        directory[c].name_length = columns[c].name_length;
+        position += columns[c].name_length + 1;
+    }
+    for (size_t c = 0; c < col_count; c++) {
+        uint64_t heap_size = 0;
+        for (size_t r = 0; r < row_count; r++) {
+            size_t length;
+            cell(user, r, c, &length);
+            heap_size += length + 1;
+        }
+
+        int typed = columns[c].type != CSV_SNAPSHOT_STRING && columns[c].values != NULL;
+        directory[c].type = typed ? columns[c].type : CSV_SNAPSHOT_STRING;
+        position = align_up(position);
+        directory[c].heap_offset = position;
+        directory[c].heap_size = heap_size;
+        position = align_up(position + heap_size);
+        directory[c].offsets_offset = position;
+        position += (uint64_t)row_count * sizeof(uint64_t);
+        directory[c].lengths_offset = position;
+        position += (uint64_t)row_count * sizeof(uint32_t);
+        if (typed) {
+            position = align_up(position);
+            directory[c].values_offset = position;
+            position += (uint64_t)row_count * 8;
+        }
+    }
+
+    CSVSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CSV_SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = CSV_SNAPSHOT_VERSION;
+    header.byte_order = CSV_SNAPSHOT_BYTE_ORDER;
+    header.row_count = row_count;
+    header.col_count = col_count;
+    header.file_size = position;
+
+    FILE *file = fopen(filename, "wb");
+    if (file == NULL) {
+        free(directory);
+        return -1;
+    }
+    char *io_buffer = (char *)malloc(SNAPSHOT_IO_BUFFER);
+    if (io_buffer != NULL) {
+        setvbuf(file, io_buffer, _IOFBF, SNAPSHOT_IO_BUFFER);
+    }
+
+    /* 머리는 체크섬을 모두 계산한 뒤 다시 씀 */
+    int failed = fwrite(&header, sizeof(header), 1, file) != 1;
+    if (!failed && col_count > 0) {
+        failed = fwrite(directory, sizeof(CSVSnapshotColumn), col_count, file) != col_count;
+    }
+
+    SnapshotOutput out;
+    out.file = file;
+    out.hash = FNV_OFFSET;
+    out.carry_len = 0;
+    out.position = sizeof(CSVSnapshotHeader) + (uint64_t)col_count * sizeof(CSVSnapshotColumn);
+    out.failed = failed;
+
+    static const char nul = '\0';
+    for (size_t c = 0; c < col_count; c++) {
+        output_write(&out, columns[c].name, columns[c].name_length);
+        output_write(&out, &nul, 1);
+    }
+    for (size_t c = 0; c < col_count && !out.failed; c++) {
+        output_pad(&out);
+        for (size_t r = 0; r < row_count; r++) {
+            size_t length;
+            const char *value = cell(user, r, c, &length);
+            output_write(&out, value, length);
+            output_write(&out, &nul, 1);
+        }
+
+        output_pad(&out);
+        uint64_t offset = 0;
+        for (size_t r = 0; r < row_count; r++) {
+            size_t length;
+            cell(user, r, c, &length);
+            output_write(&out, &offset, sizeof(offset));
+            offset += length + 1;
+        }
+        for (size_t r = 0; r < row_count; r++) {
+            size_t length;
+            cell(user, r, c, &length);
+            uint32_t stored = (uint32_t)length;
+            output_write(&out, &stored, sizeof(stored));
+        }
+
+        if (directory[c].values_offset != 0) {
+            output_pad(&out);
+            output_write(&out, columns[c].values, row_count * 8);
+        }
+    }
+
+    if (!out.failed) {
+        header.payload_checksum = output_finish(&out);
+        header.directory_checksum = directory_checksum(&header, directory, col_count);
+        out.failed = fseek(file, 0, SEEK_SET) != 0 ||
+                     fwrite(&header, sizeof(header), 1, file) != 1;
+    }
+    if (fclose(file) != 0) {
+        out.failed = 1;
+    }
+    free(io_buffer);
+    free(directory);
+
+    if (out.failed) {
+        remove(filename);
+        return -1;
+    }
+    return 0;
+}
+
+/* ===== 검사 ===== */
+
+/**
+ * @brief [offset, offset + count * width)가 파일 안에 있고 align에 맞는지 확인
+ */
+static int range_ok(uint64_t offset, uint64_t count, uint64_t width, uint64_t align, uint64_t size) {
+    if (offset > size || offset % align != 0) {
+        return 0;
+    }
+    if (width != 0 && count > (size - offset) / width) {
+        return 0;
+    }
+    return 1;
+}
+
+int csv_snapshot_validate(const void *data, size_t size, int verify_payload) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    if (data == NULL || size < sizeof(CSVSnapshotHeader)) {
+        return -1;
+    }
+
+    CSVSnapshotHeader header;
+    memcpy(&header, bytes, sizeof(header));
+    if (memcmp(header.magic, CSV_SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != CSV_SNAPSHOT_VERSION ||
+        header.byte_order != CSV_SNAPSHOT_BYTE_ORDER ||
+        header.file_size != size) {
+        return -1;
+    }
+    if (!range_ok(sizeof(header), header.col_count, sizeof(CSVSnapshotColumn), SNAPSHOT_ALIGN, size)) {
+        return -1;
+    }
+
+    const CSVSnapshotColumn *columns = (const CSVSnapshotColumn *)(bytes + sizeof(header));
+    size_t col_count = (size_t)header.col_count;
+    if (directory_checksum(&header, columns, col_count) != header.directory_checksum) {
+        return -1;
+    }
+
+    uint64_t rows = header.row_count;
+    for (size_t c = 0; c < col_count; c++) {
+        const CSVSnapshotColumn *column = &columns[c];
+        if (column->name_length >= size ||
+            !range_ok(column->name_offset, column->name_length + 1, 1, 1, size) ||
+            bytes[column->name_offset + column->name_length] != '\0' ||
+            !range_ok(column->heap_offset, column->heap_size, 1, 1, size) ||
+            !range_ok(column->offsets_offset, rows, sizeof(uint64_t), sizeof(uint64_t), size) ||
+            !range_ok(column->lengths_offset, rows, sizeof(uint32_t), sizeof(uint32_t), size) ||
+            column->type > CSV_SNAPSHOT_DOUBLE) {
+            return -1;
+        }
+        if (column->type != CSV_SNAPSHOT_STRING) {
+            if (!range_ok(column->values_offset, rows, 8, 8, size)) {
+                return -1;
+            }
+        }
+    }
+
+    if (!verify_payload) {
+        return 0;
+    }
+
+    size_t payload = sizeof(header) + col_count * sizeof(CSVSnapshotColumn);
+    if (csv_snapshot_checksum(bytes + payload, size - payload) != header.payload_checksum) {
+        return -1;
+    }
+    /* 체크섬이 맞아도 셀 위치가 힙 안에 있는지 확인 (악의적으로 만든 파일 대비) */
+    for (size_t c = 0; c < col_count; c++) {
+        const CSVSnapshotColumn *column = &columns[c];
+        const uint64_t *offsets = (const uint64_t *)(bytes + column->offsets_offset);
+        const uint32_t *lengths = (const uint32_t *)(bytes + column->lengths_offset);
+        for (uint64_t r = 0; r < rows; r++) {
+            if (offsets[r] >= column->heap_size ||
+                lengths[r] >= column->heap_size - offsets[r] ||
+                bytes[column->heap_offset + offsets[r] + lengths[r]] != '\0') {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* ===== 매핑 ===== */
+
+#ifdef _WIN32
+
+void* csv_snapshot_map(const char *filename, size_t *size) {
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return NULL;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL) {
+        return NULL;
+    }
+    /* 뷰가 매핑 객체를 참조하므로 핸들은 바로 닫아도 됨 */
+    void *data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == NULL) {
+        return NULL;
+    }
+    *size = (size_t)file_size.QuadPart;
+    return data;
+}
+
+void csv_snapshot_unmap(void *data, size_t size) {
+    (void)size;
+    if (data != NULL) {
+        UnmapViewOfFile(data);
+    }
+}
+
+#else
+
+void* csv_snapshot_map(const char *filename, size_t *size) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+    *size = (size_t)st.st_size;
+    return data;
+}
+
+void csv_snapshot_unmap(void *data, size_t size) {
+    if (data != NULL) {
+        munmap(data, size);
+    }
+}
+
+#endif
@@ -0,0 +1,263 @@
+#include "mylib/csv_tokenizer.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define INITIAL_FIELD_CAPACITY 8
+
+/*
+ * RFC 4180 필드 상태 기계 (토크나이저와 csv_field_decode() 공용)
+ *
+ * 바이트를 문자 부류로 바꾼 뒤 transitions[상태][부류]에서 다음 상태와 동작을 한 번에 읽습니다.
+ * 따옴표 밖에서 만난 "는 따옴표 구간을 열고(앞에 다른 글자가 있어도 관대하게 허용),
+ * 따옴표 안의 ""는 " 한 글자, 닫는 따옴표 뒤의 글자는 그대로 값에 이어 붙입니다.
+ *
+ * 토크나이저는 스캐너가 찾은 특수 문자에서만 전이합니다. 건너뛴 일반 글자는
+ * QUOTE_SEEN을 UNQUOTED로 바꿀 뿐이고, 두 상태는 특수 문자에서 같은 동작을 하므로 결과가 같습니다.
+ */
+enum {
+    CLASS_OTHER = 0,
+    CLASS_QUOTE,
+    CLASS_DELIMITER,
+    CLASS_LINE_END
+};
+
+enum {
+    STATE_UNQUOTED = 0,  /* 따옴표 밖 */
+    STATE_QUOTED,        /* 따옴표 안 */
+    STATE_QUOTE_SEEN     /* 따옴표 안에서 "를 만남: 닫는 따옴표이거나 ""의 앞 글자 */
+};
+
+#define STATE_MASK 0x03
+#define ACTION_EMIT 0x04        /* 바이트가 값에 들어감 */
+#define ACTION_FIELD_END 0x08   /* 필드 끝 (구분자) */
+#define ACTION_RECORD_END 0x10  /* 레코드 끝 (줄바꿈) */
+
+static const unsigned char char_class[256] = {
+    [','] = CLASS_DELIMITER,
+    ['"'] = CLASS_QUOTE,
+    ['\r'] = CLASS_LINE_END,
+    ['\n'] = CLASS_LINE_END,
+};
+
+static const unsigned char transitions[3][4] = {
+    /* STATE_UNQUOTED */
+    { STATE_UNQUOTED | ACTION_EMIT, STATE_QUOTED,
+      STATE_UNQUOTED | ACTION_FIELD_END, STATE_UNQUOTED | ACTION_RECORD_END },
+    /* STATE_QUOTED */
+    { STATE_QUOTED | ACTION_EMIT, STATE_QUOTE_SEEN,
+      STATE_QUOTED | ACTION_EMIT, STATE_QUOTED | ACTION_EMIT },
+    /* STATE_QUOTE_SEEN */
+    { STATE_UNQUOTED | ACTION_EMIT, STATE_QUOTED | ACTION_EMIT,
+      STATE_UNQUOTED | ACTION_FIELD_END, STATE_UNQUOTED | ACTION_RECORD_END },
+};
+
+void csv_record_init(CSVRecord *rec) {
+    rec->fields = NULL;
+    rec->count = 0;
+    rec->capacity = 0;
+}
+
+void csv_record_free(CSVRecord *rec) {
+    if (rec == NULL) {
+        return;
+    }
+    free(rec->fields);
+    csv_record_init(rec);
+}
+
+/**
+ * @brief 레코드에 필드를 추가합니다 (필요하면 2배 확장)
+ * @return 성공 시 0, 실패 시 -1
+ */
+static int record_push(CSVRecord *rec, const char *data, size_t length, int quoted) {
+    if (rec->count >= rec->capacity) {
+        size_t new_capacity = (rec->capacity == 0) ? INITIAL_FIELD_CAPACITY : rec->capacity * 2;
+        CSVField *new_fields = (CSVField *)realloc(rec->fields, new_capacity * sizeof(CSVField));
+        if (new_fields == NULL) {
+            return -1;
+        }
+        rec->fields = new_fields;
+        rec->capacity = new_capacity;
+    }
+
+    CSVField *field = &rec->fields[rec->count++];
+    field->data = data;
+    field->length = length;
+    field->quoted = quoted;
+    return 0;
+}
+
+void csv_tokenizer_init(CSVTokenizer *tok, const char *data, size_t len, int at_eof) {
+    csv_scanner_init(&tok->scanner, data, len);
+    tok->pos = 0;
+    tok->at_eof = at_eof;
+}
+
+int csv_tokenizer_next(CSVTokenizer *tok, CSVRecord *rec) {
+    CSVScanner *sc = &tok->scanner;
+    const char *data = sc->data;
+    size_t len = sc->len;
+    size_t pos = tok->pos;
+
+    rec->count = 0;
+
+    /* 빈 줄 건너뛰기 */
+    if (pos < len && (data[pos] == '\n' || data[pos] == '\r')) {
+        while (pos < len && (data[pos] == '\n' || data[pos] == '\r')) {
+            pos++;
+        }
+        tok->pos = pos;
+        csv_scanner_seek(sc, pos);
+    }
+    if (pos >= len) {
+        return 0;
+    }
+
+    size_t field_start = pos;
+    int quoted = 0;
+    unsigned state = STATE_UNQUOTED;
+
+    for (;;) {
+        size_t special = csv_scanner_next(sc);
+
+        if (special >= len) {
+            /* 버퍼 끝: 입력이 더 남아 있으면 끊긴 레코드이므로 다음 버퍼를 기다림 */
+            if (!tok->at_eof) {
+                rec->count = 0;
+                return 0;
+            }
+            if (record_push(rec, data + field_start, len - field_start, quoted) != 0) {
+                return -1;
+            }
+            tok->pos = len;
+            return 1;
+        }
+
+        unsigned char c = (unsigned char)data[special];
+        unsigned char cls = char_class[c];
+        unsigned char next = transitions[state][cls];
+        state = next & STATE_MASK;
+        quoted |= (cls == CLASS_QUOTE);
+        if (!(next & (ACTION_FIELD_END | ACTION_RECORD_END))) {
+            continue;
+        }
+
+        if (record_push(rec, data + field_start, special - field_start, quoted) != 0) {
+            return -1;
+        }
+
+        if (next & ACTION_FIELD_END) {
+            field_start = special + 1;
+            quoted = 0;
+            continue;
+        }
+
+        /* 줄 끝: "\r\n"은 한 번에 소비하여 다음 레코드에서 다시 스캔하지 않음 */
+        size_t end = special + 1;
+        if (c == '\r' && end < len && data[end] == '\n') {
+            csv_scanner_next(sc);
+            end++;
+        }
+        tok->pos = end;
+        return 1;
+    }
+}
+
+size_t csv_field_decode(const CSVField *field, char *out) {
+    if (!field->quoted) {
+        memmove(out, field->data, field->length);
+        return field->length;
+    }
+
+    /* 흔한 경우: 전체를 감싼 따옴표 안에 "가 없으면 안쪽을 그대로 복사 */
+    const char *data = field->data;
+    size_t length = field->length;
+    if (length >= 2 && data[0] == '"' && data[length - 1] == '"' && memchr(data + 1, '"', length - 2) == NULL) {
+        memmove(out, data + 1, length - 2);
+        return length - 2;
+    }
+
+    /* 토크나이저처럼 "에서만 전이: 일반 글자는 바로 쓰고, 앞의 " 뒤로 일반 글자가 있었으면
+       그 구간을 CLASS_OTHER 전이 한 번으로 반영 (written <= i이므로 제자리 가능) */
+    size_t written = 0;
+    size_t after_quote = 0;
+    unsigned state = STATE_UNQUOTED;
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] != '"') {
+            out[written++] = data[i];
+            continue;
+        }
+        if (i > after_quote) {
+            state = transitions[state][CLASS_OTHER] & STATE_MASK;
+        }
+        unsigned char next = transitions[state][CLASS_QUOTE];
+        out[written] = '"';
+        written += (next & ACTION_EMIT) >> 2;
+        state = next & STATE_MASK;
+        after_quote = i + 1;
+    }
+    return written;
+}
+
+static int is_blank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+int csv_field_needs_quotes(const char *value, size_t length) {
+    if (length == 0) {
+        return 0;
+    }
+    /* 따옴표 없는 필드는 읽을 때 앞뒤 공백이 잘리므로 공백도 보존하려면 감싸야 함 */
+    if (is_blank(value[0]) || is_blank(value[length - 1])) {
+        return 1;
+    }
+    return csv_scan_special(value, length) < length;
+}
+
+size_t csv_field_encode(const char *value, size_t length, char *out) {
+    if (length == 0) {
+        return 0;
+    }
+    if (!csv_field_needs_quotes(value, length)) {
+        memcpy(out, value, length);
+        return length;
+    }
+
+    size_t written = 0;
+    out[written++] = '"';
+    const char *end = value + length;
+    while (value < end) {
+        const char *quote = (const char *)memchr(value, '"', (size_t)(end - value));
+        size_t run = (quote != NULL) ? (size_t)(quote - value) + 1 : (size_t)(end - value);
+        memcpy(out + written, value, run);
+        written += run;
+        value += run;
+        if (quote != NULL) {
+            out[written++] = '"';  /* "는 ""로 */
+        }
+    }
+    out[written++] = '"';
+    return written;
+}
+
+void csv_chunk_plan(size_t begin, size_t end, size_t n, size_t *bounds) {
+    size_t total = end - begin;
+
+    for (size_t i = 0; i < n; i++) {
+        /* 곱셈 오버플로우를 피하기 위해 몫과 나머지로 나누어 계산 */
+        bounds[i] = begin + (total / n) * i + (total % n) * i / n;
+    }
+    bounds[n] = end;
+}
+
+void csv_chunk_align(const char *data, size_t n, const size_t *quote_counts, size_t *bounds) {
+    size_t len = bounds[n];
+    int in_quotes = 0;
+
+    for (size_t i = 1; i < n; i++) {
+        in_quotes ^= (int)(quote_counts[i - 1] & 1);
+
+        size_t aligned = csv_scan_record_end(data, len, bounds[i], in_quotes);
+        bounds[i] = (aligned > bounds[i - 1]) ? aligned : bounds[i - 1];
+    }
+}
@@ -0,0 +1,268 @@
+#include "mylib/reduce.h"
+#include <math.h>
+
+/*
+ * 왜 이렇게?: csv_scan.c와 같은 방식
+ * - SSE2는 x86-64의 기본 사양이므로 컴파일 타임에 항상 사용
+ * - AVX2는 CPU마다 다르므로 target 속성으로 따로 컴파일하고 처음 호출될 때 선택
+ * - SSE2에는 64비트 정수 비교가 없으므로 int64 최솟값/최댓값은 스칼라로 처리
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define REDUCE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(REDUCE_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define REDUCE_AVX2 1
+#include <immintrin.h>
+#endif
+
+typedef struct {
+    long long (*sum_int)(const int *values, size_t count);
+    void (*int64)(const int64_t *values, size_t count, ReduceInt64 *out);
+    void (*dbl)(const double *values, size_t count, ReduceDouble *out);
+    const char *name;
+} ReduceKernels;
+
+/* ===== 이식용 기본 구현 (SIMD 구현의 꼬리 처리에도 사용) ===== */
+
+static long long sum_int_scalar(const int *values, size_t count) {
+    long long sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        sum += values[i];
+    }
+    return sum;
+}
+
+static void int64_scalar(const int64_t *values, size_t count, ReduceInt64 *out) {
+    /* 합계는 부호 없는 정수로 더해 순환을 정의된 동작으로 만듦 */
+    uint64_t sum = (uint64_t)out->sum;
+    int64_t min = out->min;
+    int64_t max = out->max;
+    for (size_t i = 0; i < count; i++) {
+        int64_t v = values[i];
+        sum += (uint64_t)v;
+        min = (v < min) ? v : min;
+        max = (v > max) ? v : max;
+    }
+    out->sum = (int64_t)sum;
+    out->min = min;
+    out->max = max;
+}
+
+static void double_scalar(const double *values, size_t count, ReduceDouble *out) {
+    double sum = out->sum;
+    double min = out->min;
+    double max = out->max;
+    for (size_t i = 0; i < count; i++) {
+        double v = values[i];
+        sum += v;
+        min = (v < min) ? v : min;  /* NaN은 비교가 거짓이므로 건너뜀 */
+        max = (v > max) ? v : max;
+    }
+    out->sum = sum;
+    out->min = min;
+    out->max = max;
+}
+
+#ifndef REDUCE_SSE2
+static const ReduceKernels SCALAR_KERNELS = { sum_int_scalar, int64_scalar, double_scalar, "scalar" };
+#endif
+
+/* ===== SSE2 ===== */
+
+#ifdef REDUCE_SSE2
+static long long sum_int_sse2(const int *values, size_t count) {
+    __m128i acc_lo = _mm_setzero_si128();
+    __m128i acc_hi = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+        __m128i sign = _mm_srai_epi32(v, 31);  /* 부호 확장용 상위 32비트 */
+        acc_lo = _mm_add_epi64(acc_lo, _mm_unpacklo_epi32(v, sign));
+        acc_hi = _mm_add_epi64(acc_hi, _mm_unpackhi_epi32(v, sign));
+    }
+
+    long long lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(acc_lo, acc_hi));
+    return lanes[0] + lanes[1] + sum_int_scalar(values + i, count - i);
+}
+
+static void double_sse2(const double *values, size_t count, ReduceDouble *out) {
+    __m128d sum0 = _mm_setzero_pd(), sum1 = _mm_setzero_pd();
+    __m128d min0 = _mm_set1_pd(out->min), min1 = min0;
+    __m128d max0 = _mm_set1_pd(out->max), max1 = max0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128d a = _mm_loadu_pd(values + i);
+        __m128d b = _mm_loadu_pd(values + i + 2);
+        sum0 = _mm_add_pd(sum0, a);
+        sum1 = _mm_add_pd(sum1, b);
+        /* minpd/maxpd는 한쪽이 NaN이면 두 번째 피연산자를 돌려주므로 누산기를 뒤에 둠 */
+        min0 = _mm_min_pd(a, min0);
+        min1 = _mm_min_pd(b, min1);
+        max0 = _mm_max_pd(a, max0);
+        max1 = _mm_max_pd(b, max1);
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+    out->sum += lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, _mm_min_pd(min0, min1));
+    out->min = (lanes[0] < lanes[1]) ? lanes[0] : lanes[1];
+    _mm_storeu_pd(lanes, _mm_max_pd(max0, max1));
+    out->max = (lanes[0] > lanes[1]) ? lanes[0] : lanes[1];
+    double_scalar(values + i, count - i, out);
+}
+
+static const ReduceKernels SSE2_KERNELS = { sum_int_sse2, int64_scalar, double_sse2, "sse2" };
+#endif
+
+/* ===== AVX2 ===== */
+
+#ifdef REDUCE_AVX2
+__attribute__((target("avx2")))
+static long long sum_int_avx2(const int *values, size_t count) {
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(values + i))));
+        acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(values + i + 4))));
+    }
+
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(acc0, acc1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_int_scalar(values + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void int64_avx2(const int64_t *values, size_t count, ReduceInt64 *out) {
+    __m256i sum = _mm256_setzero_si256();
+    __m256i min = _mm256_set1_epi64x(out->min);
+    __m256i max = _mm256_set1_epi64x(out->max);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+        sum = _mm256_add_epi64(sum, v);
+        min = _mm256_blendv_epi8(min, v, _mm256_cmpgt_epi64(min, v));
+        max = _mm256_blendv_epi8(max, v, _mm256_cmpgt_epi64(v, max));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, sum);
+    uint64_t total = (uint64_t)out->sum;
+    for (int k = 0; k < 4; k++) {
+        total += (uint64_t)lanes[k];
+    }
+    out->sum = (int64_t)total;
+    _mm256_storeu_si256((__m256i *)lanes, min);
+    for (int k = 0; k < 4; k++) {
+        out->min = (lanes[k] < out->min) ? lanes[k] : out->min;
+    }
+    _mm256_storeu_si256((__m256i *)lanes, max);
+    for (int k = 0; k < 4; k++) {
+        out->max = (lanes[k] > out->max) ? lanes[k] : out->max;
+    }
+    int64_scalar(values + i, count - i, out);
+}
+
+__attribute__((target("avx2")))
+static void double_avx2(const double *values, size_t count, ReduceDouble *out) {
+    __m256d sum0 = _mm256_setzero_pd(), sum1 = _mm256_setzero_pd();
+    __m256d min0 = _mm256_set1_pd(out->min), min1 = min0;
+    __m256d max0 = _mm256_set1_pd(out->max), max1 = max0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256d a = _mm256_loadu_pd(values + i);
+        __m256d b = _mm256_loadu_pd(values + i + 4);
+        sum0 = _mm256_add_pd(sum0, a);
+        sum1 = _mm256_add_pd(sum1, b);
+        min0 = _mm256_min_pd(a, min0);
+        min1 = _mm256_min_pd(b, min1);
+        max0 = _mm256_max_pd(a, max0);
+        max1 = _mm256_max_pd(b, max1);
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(sum0, sum1));
+    out->sum += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    _mm256_storeu_pd(lanes, _mm256_min_pd(min0, min1));
+    for (int k = 0; k < 4; k++) {
+        out->min = (lanes[k] < out->min) ? lanes[k] : out->min;
+    }
+    _mm256_storeu_pd(lanes, _mm256_max_pd(max0, max1));
+    for (int k = 0; k < 4; k++) {
+        out->max = (lanes[k] > out->max) ? lanes[k] : out->max;
+    }
+    double_scalar(values + i, count - i, out);
+}
+
+static const ReduceKernels AVX2_KERNELS = { sum_int_avx2, int64_avx2, double_avx2, "avx2" };
+#endif
+
+/* ===== 선택 ===== */
+
+static const ReduceKernels* resolve_kernels(void) {
+#ifdef REDUCE_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return &AVX2_KERNELS;
+    }
+#endif
+#ifdef REDUCE_SSE2
+    return &SSE2_KERNELS;
+#else
+    return &SCALAR_KERNELS;
+#endif
+}
+
+/* 왜 이렇게?: 선택 결과는 항상 같으므로 동시에 초기화해도 같은 값을 씀 */
+static const ReduceKernels *g_kernels = NULL;
+
+static const ReduceKernels* get_kernels(void) {
+#if defined(__GNUC__) || defined(__clang__)
+    const ReduceKernels *kernels = __atomic_load_n(&g_kernels, __ATOMIC_RELAXED);
+    if (kernels == NULL) {
+        kernels = resolve_kernels();
+        __atomic_store_n(&g_kernels, kernels, __ATOMIC_RELAXED);
+    }
+    return kernels;
+#else
+    if (g_kernels == NULL) {
+        g_kernels = resolve_kernels();
+    }
+    return g_kernels;
+#endif
+}
+
+long long reduce_sum_int(const int *values, size_t count) {
+    if (values == NULL || count == 0) {
+        return 0;
+    }
+    return get_kernels()->sum_int(values, count);
+}
+
+void reduce_int64(const int64_t *values, size_t count, ReduceInt64 *out) {
+    out->sum = 0;
+    out->min = INT64_MAX;
+    out->max = INT64_MIN;
+    out->count = count;
+    if (values != NULL && count > 0) {
+        get_kernels()->int64(values, count, out);
+    }
+}
+
+void reduce_double(const double *values, size_t count, ReduceDouble *out) {
+    out->sum = 0.0;
+    out->min = INFINITY;
+    out->max = -INFINITY;
+    out->count = count;
+    if (values != NULL && count > 0) {
+        get_kernels()->dbl(values, count, out);
+    }
+}
+
+const char* reduce_backend(void) {
+    return get_kernels()->name;
+}
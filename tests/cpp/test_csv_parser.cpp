@@ -1,7 +1,19 @@
 #include "cpp/mylib/CSVParser.hpp"
+#include "cpp/mylib/CSVNumber.hpp"
+#include "cpp/mylib/CSVReader.hpp"
+#include "cpp/mylib/CSVWriter.hpp"
+#include "mylib/csv_parser.h"
+#include "mylib/csv_snapshot.h"
 #include <iostream>
 #include <cassert>
+#include <charconv>
+#include <cstring>
 #include <stdexcept>
+#include <fstream>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
 
 using namespace mylib;
 
@@ -86,6 +98,1558 @@ void test_out_of_range() {
     std::cout << "✓ test_out_of_range passed\n";
 }
 
+void test_mapped_mode() {
+    CSVParser copied;
+    copied.parse("tests/test_data.csv");
+
+    CSVParser mapped;
+    mapped.parse("tests/test_data.csv", ParseMode::Mapped);
+
+    assert(mapped.isMapped());
+    assert(!copied.isMapped());
+    assert(mapped.rowCount() == copied.rowCount());
+    assert(mapped.headers() == copied.headers());
+
+    for (size_t row = 0; row < copied.rowCount(); ++row) {
+        assert(mapped.getRow(row) == copied.getRow(row));
+    }
+    assert(mapped.getView(0, 0) == "Alice");
+    assert(mapped.getView(4, 3) == "91.2");
+
+    auto row_view = mapped.getRowView(1);
+    assert(row_view.size() == 4);
+    assert(row_view[2] == "Busan");
+
+    // 복사본도 매핑을 공유하므로 원본이 사라져도 뷰가 유효해야 함
+    CSVParser* temp = new CSVParser();
+    temp->parse("tests/test_data.csv", ParseMode::Mapped);
+    CSVParser shared = *temp;
+    delete temp;
+    assert(shared.getView(2, 0) == "Charlie");
+
+    std::cout << "✓ test_mapped_mode passed\n";
+}
+
+void test_materialize() {
+    CSVParser parser;
+    parser.parse("tests/test_data.csv", ParseMode::Mapped);
+    parser.materialize();
+
+    assert(!parser.isMapped());
+    assert(parser.rowCount() == 5);
+    assert(parser.get(3, 2) == "Daegu");
+
+    try {
+        parser.getView(0, 100);
+        assert(false && "Should have thrown exception");
+    } catch (const std::out_of_range& e) {
+        // 예외 발생 - 정상
+    }
+
+    std::cout << "✓ test_materialize passed\n";
+}
+
+void test_quoted_fields() {
+    const char* path = "tests/test_quoted.csv";
+    {
+        std::ofstream out(path);
+        out << "name,city\n\"Kim, Minsu\",  Seoul  \n";
+    }
+
+    CSVParser copied;
+    copied.parse(path);
+    assert(copied.get(0, 0) == "Kim, Minsu");
+    assert(copied.get(0, 1) == "Seoul");
+
+    CSVParser mapped;
+    mapped.parse(path, ParseMode::Mapped);
+    assert(mapped.getView(0, 0) == "Kim, Minsu");
+    assert(mapped.getView(0, 1) == "Seoul");
+
+    // RFC 4180: 따옴표 안의 "", 쉼표, 줄바꿈 (모든 모드와 스트리밍 리더가 같은 값)
+    {
+        std::ofstream out(path);
+        out << "name,note\n\"Lee, \"\"J\"\"\",\"say \"\"hi\"\"\r\nbye\"\n\"\"\"\",\"\"\n";
+    }
+    for (ParseMode mode : {ParseMode::Copy, ParseMode::Mapped, ParseMode::Lazy}) {
+        CSVParser parser;
+        parser.parse(path, mode);
+        assert(parser.rowCount() == 2);
+        assert(parser.get(0, 0) == "Lee, \"J\"");
+        assert(parser.get(0, 1) == "say \"hi\"\r\nbye");
+        assert(parser.get(1, 0) == "\"" && parser.get(1, 1).empty());
+    }
+    {
+        CSVReader reader(path);
+        assert(reader.next() && reader.row()[0] == "Lee, \"J\"");
+    }
+
+    // 쓴 뒤 다시 읽어도 같은 값
+    CSVParser escaped;
+    escaped.parse(path);
+    const char* written = "tests/test_quoted_out.csv";
+    escaped.write(written);
+    CSVParser reread;
+    reread.parse(written);
+    assert(reread.get(0, 0) == escaped.get(0, 0) && reread.get(0, 1) == escaped.get(0, 1));
+    assert(reread.get(1, 0) == "\"");
+    std::remove(written);
+
+    std::remove(path);
+    std::cout << "✓ test_quoted_fields passed\n";
+}
+
+void test_parallel_parse() {
+    const char* path = "tests/test_large_cpp.csv";
+    {
+        std::ofstream out(path);
+        out << "id,name,note\n";
+        for (int i = 0; i < 20000; ++i) {
+            if (i % 97 == 0) {
+                out << i << ",\"user, " << i << "\",\"line1\nline2\"\n";
+            } else {
+                out << i << ",user" << i << ",note " << i * 7 << "\n";
+            }
+        }
+    }
+
+    ParseOptions single;
+    single.mode = ParseMode::Mapped;
+    CSVParser reference;
+    reference.parse(path, single);
+
+    ParseOptions multi;
+    multi.threads = 4;
+    CSVParser copied;
+    copied.parse(path, multi);
+
+    multi.mode = ParseMode::Mapped;
+    CSVParser mapped;
+    mapped.parse(path, multi);
+
+    assert(reference.rowCount() == 20000);
+    assert(copied.rowCount() == reference.rowCount());
+    assert(mapped.rowCount() == reference.rowCount());
+    for (size_t row = 0; row < reference.rowCount(); row += 37) {
+        assert(copied.getRow(row) == reference.getRow(row));
+        assert(mapped.getRowView(row) == reference.getRowView(row));
+    }
+    assert(mapped.getView(194, 2) == "line1\nline2");
+    assert(copied.get(19999, 0) == "19999");
+
+    std::remove(path);
+    std::cout << "✓ test_parallel_parse passed\n";
+}
+
+void test_streaming_reader() {
+    CSVReader reader("tests/test_data.csv");
+    assert(reader.headers().size() == 4);
+    assert(reader.headers()[0] == "name");
+
+    size_t rows = 0;
+    std::string last_city;
+    for (const auto& row : reader) {
+        assert(row.size() == 4);
+        last_city = std::string(row[2]);
+        ++rows;
+    }
+    assert(rows == 5);
+    assert(last_city == "Gwangju");
+    IOStats stats = reader.ioStats();
+    assert(stats.bytes_read > 0);
+    assert(!stats.threaded);  // 블록 하나보다 작은 파일은 바로 읽음
+
+    double score_sum = 0.0;
+    size_t visited = CSVParser::forEachRow("tests/test_data.csv",
+        [&](const std::vector<std::string_view>& row) {
+            score_sum += std::stod(std::string(row[3]));
+            return true;
+        });
+    assert(visited == 5);
+    assert(score_sum > 454.4 && score_sum < 454.6);
+
+    size_t stopped = CSVParser::forEachRow("tests/test_data.csv",
+        [](const std::vector<std::string_view>&) { return false; });
+    assert(stopped == 1);
+
+    try {
+        CSVReader missing("nonexistent_file.csv");
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error& e) {
+        // 예외 발생 - 정상
+    }
+
+    std::cout << "✓ test_streaming_reader passed\n";
+}
+
+void test_columnar_table() {
+    CSVParser parser;
+    parser.parse("tests/test_data.csv");
+
+    const auto& names = parser.column("name");
+    assert(names.size() == parser.rowCount());
+    assert(names[0] == "Alice");
+    assert(names.at(4) == "Eve");
+    assert(!names.isBorrowed());
+
+    // 복사 모드의 열은 하나의 연속 버퍼에 행 순서대로 저장됨
+    const auto& offsets = names.offsets();
+    const auto& lengths = names.lengths();
+    for (size_t row = 1; row < names.size(); ++row) {
+        assert(offsets[row] == offsets[row - 1] + lengths[row - 1]);
+    }
+
+    assert(parser.convertColumn("age", ColumnType::Int64));
+    assert(parser.column("age").type() == ColumnType::Int64);
+    assert(parser.column("age").ints()[1] == 30);
+    assert(parser.convertColumn("score", ColumnType::Double));
+    double sum = 0.0;
+    for (double score : parser.column("score").doubles()) {
+        sum += score;
+    }
+    assert(sum > 454.4 && sum < 454.6);
+    assert(!parser.convertColumn("city", ColumnType::Int64));
+    assert(parser.column("city").type() == ColumnType::String);
+
+    CSVParser mapped;
+    mapped.parse("tests/test_data.csv", ParseMode::Mapped);
+    assert(mapped.column("city").isBorrowed());
+    mapped.materialize();
+    assert(!mapped.column("city").isBorrowed());
+    assert(mapped.column("city")[1] == "Busan");
+
+    // 짧은 행은 빈 셀로 채우고 긴 행은 자름
+    CSVTable table({"a", "b"});
+    table.appendRow({"1"});
+    table.appendRow({"2", "x", "extra"});
+    assert(table.rowCount() == 2);
+    assert(table.get(0, 1).empty());
+    assert(table.get(1, 1) == "x");
+
+    try {
+        table.column("missing");
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error& e) {
+        // 예외 발생 - 정상
+    }
+
+    std::cout << "✓ test_columnar_table passed\n";
+}
+
+void test_type_inference() {
+    ParseOptions options;
+    options.infer_types = true;
+    CSVParser parser;
+    parser.parse("tests/test_data.csv", options);
+
+    const auto& table = parser.table();
+    assert(table.column("name").type() == ColumnType::String);
+    assert(table.column("age").type() == ColumnType::Int64);
+    assert(table.column("score").type() == ColumnType::Double);
+
+    assert(parser.getInt(2, 1) == 22);
+    assert(parser.getDouble(0, 3) == 95.5);
+    assert(parser.getDouble(0, 1) == 25.0);
+    assert(parser.column<int64_t>("age").size() == 5);
+    assert(parser.column<double>("score")[4] == 91.2);
+    assert(parser.get(1, 3) == "88.0");  // 원문은 그대로 유지
+
+    try {
+        parser.getInt(0, 0);
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error& e) {
+        // 예외 발생 - 정상
+    }
+    try {
+        parser.column<int64_t>("score");
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error& e) {
+        // 예외 발생 - 정상
+    }
+
+    // 표본 밖의 값이 정수가 아니면 더 넓은 타입으로 물러남
+    CSVTable mixed({"v"});
+    mixed.appendRow({"1"});
+    mixed.appendRow({"2"});
+    mixed.appendRow({"2.5"});
+    mixed.appendRow({"n/a"});
+    assert(mixed.column(0).infer(2) == ColumnType::String);
+    CSVTable widened({"v"});
+    widened.appendRow({"1"});
+    widened.appendRow({"2.5"});
+    assert(widened.column(0).infer(1) == ColumnType::Double);
+    assert(widened.getDouble(0, 0) == 1.0);
+
+    std::cout << "✓ test_type_inference passed\n";
+}
+
+void test_projection() {
+    CSVParser parser;
+    parser.parse("tests/test_data.csv", {"score", "name"});
+    assert(parser.colCount() == 2);
+    assert(parser.rowCount() == 5);
+    assert(parser.headers()[0] == "score");
+    assert(parser.get(0, 0) == "95.5");
+    assert(parser.get(3, 1) == "Diana");
+
+    CSVReader reader("tests/test_data.csv", {"city"});
+    assert(reader.headers().size() == 1);
+    assert(reader.next());
+    assert(reader.row().size() == 1 && reader.row()[0] == "Seoul");
+
+    // 프로젝션은 Mapped 모드, 병렬 파싱과 함께 쓸 수 있음
+    const char* path = "tests/test_large_cpp.csv";
+    {
+        std::ofstream out(path);
+        out << "id,name,note\n";
+        for (int i = 0; i < 20000; ++i) {
+            out << i << ",\"user, " << i << "\",note " << i << "\n";
+        }
+    }
+    ParseOptions options;
+    options.mode = ParseMode::Mapped;
+    options.threads = 4;
+    options.columns = {"name"};
+    CSVParser mapped;
+    mapped.parse(path, options);
+    assert(mapped.colCount() == 1);
+    assert(mapped.rowCount() == 20000);
+    assert(mapped.getView(12345, 0) == "user, 12345");
+
+    // 같은 따옴표 열을 두 번 골라도 한 번만 복원 (제자리 복원을 되풀이하면 값이 깨짐)
+    {
+        std::ofstream out(path);
+        out << "a,b\n\"x\"\"y\",2\n\"p,q\",3\n";
+    }
+    for (ParseMode mode : {ParseMode::Copy, ParseMode::Mapped}) {
+        for (size_t threads : {1, 2}) {
+            ParseOptions twice;
+            twice.mode = mode;
+            twice.threads = threads;
+            twice.columns = {"a", "b", "a"};
+            CSVParser repeated;
+            repeated.parse(path, twice);
+            assert(repeated.colCount() == 3);
+            assert(repeated.get(0, 0) == "x\"y" && repeated.get(0, 2) == "x\"y");
+            assert(repeated.get(1, 0) == "p,q" && repeated.get(1, 2) == "p,q");
+            assert(repeated.get(1, 1) == "3");
+        }
+    }
+    CSVReader twice_reader(path, {"a", "a"});
+    assert(twice_reader.next());
+    assert(twice_reader.row()[0] == "x\"y" && twice_reader.row()[1] == "x\"y");
+    std::remove(path);
+
+    try {
+        parser.parse("tests/test_data.csv", {"name", "missing"});
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error& e) {
+        // 예외 발생 - 정상, 기존 데이터는 유지
+        assert(parser.colCount() == 2);
+    }
+
+    std::cout << "✓ test_projection passed\n";
+}
+
+void test_filter() {
+    ParseOptions options;
+    options.filters.emplace_back("score", CompareOp::Greater, 90);
+    CSVParser parser;
+    parser.parse("tests/test_data.csv", options);
+    assert(parser.rowCount() == 3);
+    assert(parser.get(0, 0) == "Alice");
+    assert(parser.get(2, 0) == "Eve");
+
+    // 조건 열이 프로젝션 밖에 있어도 됨, 여러 조건은 AND
+    options.columns = {"name"};
+    options.filters.emplace_back("city", CompareOp::NotEqual, "Seoul");
+    parser.parse("tests/test_data.csv", options);
+    assert(parser.colCount() == 1);
+    assert(parser.rowCount() == 2);
+    assert(parser.get(0, 0) == "Charlie");
+
+    // Mapped 모드에서 조건 열과 결과 열이 같아도 값이 한 번만 복원됨
+    const char* path = "tests/test_quoted.csv";
+    {
+        std::ofstream out(path);
+        out << "name,city\n\"Kim, Minsu\",Seoul\n\"Lee, \"\"J\"\"\",Busan\n";
+    }
+    ParseOptions mapped_options;
+    mapped_options.mode = ParseMode::Mapped;
+    mapped_options.filters.emplace_back("name", CompareOp::Equal, "Kim, Minsu");
+    CSVParser mapped;
+    mapped.parse(path, mapped_options);
+    assert(mapped.rowCount() == 1);
+    assert(mapped.getView(0, 0) == "Kim, Minsu");
+    assert(mapped.getView(0, 1) == "Seoul");
+
+    // 같은 열에 조건이 둘이어도 두 번째 조건이 복원된 값을 봄 (모든 모드가 같은 결과)
+    {
+        std::ofstream out(path);
+        out << "a\n\"x\"\"y\"\n\"p\"\"q\"\n";
+    }
+    for (ParseMode mode : {ParseMode::Copy, ParseMode::Mapped}) {
+        ParseOptions both;
+        both.mode = mode;
+        both.filters.emplace_back("a", CompareOp::NotEqual, "zzz");
+        both.filters.emplace_back("a", CompareOp::NotEqual, "x\"y");
+        CSVParser twice;
+        twice.parse(path, both);
+        assert(twice.rowCount() == 1);
+        assert(twice.get(0, 0) == "p\"q");
+    }
+    std::remove(path);
+
+    CSVPredicate numeric("score", CompareOp::Equal, 88);
+    assert(numeric.matches("88.0"));
+    assert(!numeric.matches("n/a"));
+    CSVPredicate text("city", CompareOp::Less, "C");
+    assert(text.matches("Busan"));
+    assert(!text.matches("Seoul"));
+
+    try {
+        ParseOptions bad;
+        bad.filters.emplace_back("missing", CompareOp::Equal, "x");
+        parser.parse("tests/test_data.csv", bad);
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error& e) {
+        // 예외 발생 - 정상
+    }
+
+    std::cout << "✓ test_filter passed\n";
+}
+
+void test_snapshot() {
+    const char* path = "tests/test_snapshot_cpp.bin";
+    ParseOptions options;
+    options.infer_types = true;
+    CSVParser parser;
+    parser.parse("tests/test_data.csv", options);
+    parser.saveSnapshot(path);
+
+    // 셀과 숫자 값이 매핑을 그대로 가리킴
+    CSVParser loaded;
+    loaded.loadSnapshot(path, true);
+    assert(loaded.isMapped());
+    assert(loaded.rowCount() == parser.rowCount());
+    assert(loaded.headers() == parser.headers());
+    assert(loaded.column("name").isBorrowed());
+    assert(loaded.column("age").type() == ColumnType::Int64);
+    assert(loaded.getInt(1, 1) == 30);
+    assert(loaded.getDouble(0, 3) == 95.5);
+    for (size_t row = 0; row < parser.rowCount(); ++row) {
+        assert(loaded.getRow(row) == parser.getRow(row));
+    }
+
+    // 매핑을 놓아도 값은 유지
+    loaded.materialize();
+    assert(!loaded.isMapped());
+    assert(loaded.get(2, 2) == "Incheon");
+
+    // C 스냅샷과 같은 형식
+    CSVData* data = csv_load_binary(path, 1);
+    assert(data != nullptr);
+    assert(std::string(csv_get(data, 4, 0)) == "Eve");
+    csv_destroy(data);
+
+    // 손상된 파일은 체크섬 검사에서 거부
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(-2, std::ios::end);
+        char byte = 0;
+        file.get(byte);
+        file.seekp(-2, std::ios::end);
+        file.put(static_cast<char>(byte ^ 0x5a));
+    }
+    bool threw = false;
+    try {
+        loaded.loadSnapshot(path, true);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // 체크섬을 건너뛰면 행마다 훑지 않고 불러오지만, 힙 밖을 가리키는 셀은 읽을 때 거부
+    parser.saveSnapshot(path);
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        CSVSnapshotColumn entry;
+        file.seekg(sizeof(CSVSnapshotHeader));
+        file.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+        const uint64_t offset = entry.heap_size + 1000;
+        file.seekp(static_cast<std::streamoff>(entry.offsets_offset + sizeof(uint64_t)));
+        file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    }
+    loaded.loadSnapshot(path);
+    assert(loaded.get(0, 0) == "Alice");
+    threw = false;
+    try {
+        loaded.get(1, 0);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        loaded.materialize();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        loaded.loadSnapshot(path, true);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(csv_load_binary(path, 0) == nullptr);
+
+    threw = false;
+    try {
+        loaded.loadSnapshot("tests/test_data.csv");
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    std::remove(path);
+    std::cout << "✓ test_snapshot passed\n";
+}
+
+void test_buffered_writer() {
+    const char* path = "tests/test_large_cpp.csv";
+    {
+        std::ofstream out(path);
+        out << "id,name,note\n";
+        for (int i = 0; i < 40000; ++i) {
+            if (i % 97 == 0) {
+                out << i << ",\"user, " << i << "\",\"line1\nline2\"\n";
+            } else {
+                out << i << ",user" << i << ",note " << i * 7 << "\n";
+            }
+        }
+    }
+    CSVParser parser;
+    parser.parse(path);
+
+    // 구분자/줄바꿈이 든 셀은 따옴표로 감싸서 다시 읽어도 같음
+    WriteOptions options;
+    parser.write("tests/test_output.csv", options);
+    options.threads = 4;
+    parser.write("tests/test_output_parallel.csv", options);
+
+    CSVParser reread;
+    reread.parse("tests/test_output.csv");
+    assert(reread.rowCount() == parser.rowCount());
+    for (size_t row = 0; row < parser.rowCount(); row += 97) {
+        assert(reread.getRow(row) == parser.getRow(row));
+    }
+
+    // 병렬 직렬화는 단일 스레드와 같은 바이트를 씀
+    auto slurp = [](const char* file) {
+        std::ifstream in(file, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    };
+    assert(slurp("tests/test_output.csv") == slurp("tests/test_output_parallel.csv"));
+    std::remove("tests/test_output_parallel.csv");
+    std::remove(path);
+
+    // 숫자 열은 값에서 포맷
+    ParseOptions typed;
+    typed.infer_types = true;
+    parser.parse("tests/test_data.csv", typed);
+    parser.write("tests/test_output.csv");
+    reread.parse("tests/test_output.csv", typed);
+    assert(reread.getDouble(0, 3) == 95.5);
+    assert(reread.get(1, 3) == "88");
+    assert(reread.getInt(4, 1) == parser.getInt(4, 1));
+
+    {
+        CSVWriter writer("tests/test_output.csv");
+        writer.writeRow(std::vector<std::string>{"name", "quote"});
+        writer.writeRow(std::vector<std::string_view>{"Kim, Minsu", " padded "});
+    }
+    reread.parse("tests/test_output.csv");
+    assert(reread.get(0, 0) == "Kim, Minsu");
+    assert(reread.get(0, 1) == " padded ");
+
+    std::cout << "✓ test_buffered_writer passed\n";
+}
+
+void test_aggregate() {
+    ParseOptions options;
+    options.infer_types = true;
+    CSVParser parser;
+    parser.parse("tests/test_data.csv", options);
+
+    auto stats = parser.aggregate("score", {AggregateOp::Sum, AggregateOp::Min, AggregateOp::Max,
+                                            AggregateOp::Mean, AggregateOp::Count});
+    assert(stats.size() == 5);
+    assert(std::abs(stats[0] - (95.5 + 88.0 + 92.3 + 87.5 + 91.2)) < 1e-9);
+    assert(stats[1] == 87.5);
+    assert(stats[2] == 95.5);
+    assert(std::abs(stats[3] - stats[0] / 5) < 1e-9);
+    assert(stats[4] == 5);
+
+    // Int64 열, 요청 순서대로 반환
+    auto ages = parser.table().aggregate("age", {AggregateOp::Max, AggregateOp::Sum});
+    assert(ages[0] == 35);
+    assert(ages[1] == 25 + 30 + 22 + 28 + 35);
+
+    try {
+        parser.aggregate("name", {AggregateOp::Sum});
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error&) {
+        // 문자열 열은 집계할 수 없음
+    }
+
+    std::cout << "✓ test_aggregate passed\n";
+}
+
+void test_group_by() {
+    const char* path = "tests/test_large_cpp.csv";
+    {
+        std::ofstream out(path);
+        out << "city,dept,score\n";
+        const char* cities[] = {"Seoul", "Busan", "Incheon"};
+        for (int i = 0; i < 200000; ++i) {
+            out << cities[i % 3] << "," << (i % 2 == 0 ? "A" : "B") << "," << (i % 100) << "\n";
+        }
+    }
+    ParseOptions options;
+    options.infer_types = true;
+    CSVParser parser;
+    parser.parse(path, options);
+
+    std::vector<GroupAggregate> aggregates = {
+        {"score", AggregateOp::Mean}, {"score", AggregateOp::Max}, {"city", AggregateOp::Count}};
+    CSVTable single = parser.groupBy({"city"}, aggregates);
+    assert(single.rowCount() == 3);
+    assert(single.headers()[1] == "mean(score)");
+    assert(single.get(0, 0) == "Seoul");  // 처음 나온 순서
+    assert(single.column("count(city)").type() == ColumnType::Int64);
+    assert(single.getInt(0, 3) + single.getInt(1, 3) + single.getInt(2, 3) == 200000);
+    assert(single.getInt(1, 2) == 99);
+
+    // 여러 스레드의 부분 집계를 합쳐도 같은 결과
+    CSVTable multi = parser.groupBy({"city"}, aggregates, 4);
+    assert(multi.rowCount() == single.rowCount());
+    for (size_t row = 0; row < single.rowCount(); ++row) {
+        assert(multi.get(row, 0) == single.get(row, 0));
+        assert(std::abs(multi.getDouble(row, 1) - single.getDouble(row, 1)) < 1e-9);
+        assert(multi.getInt(row, 3) == single.getInt(row, 3));
+    }
+
+    // 여러 키
+    CSVTable pairs = parser.groupBy({"city", "dept"}, {{"score", AggregateOp::Sum}}, 0);
+    assert(pairs.rowCount() == 6);
+    assert(pairs.colCount() == 3);
+    std::remove(path);
+
+    // 작은 표: 도시별 평균 점수
+    parser.parse("tests/test_data.csv", options);
+    CSVTable by_city = parser.groupBy({"city"}, {{"score", AggregateOp::Mean}});
+    assert(by_city.rowCount() == 5);
+    assert(by_city.getDouble(1, 1) == 88.0);
+
+    try {
+        parser.groupBy({"city"}, {{"name", AggregateOp::Sum}});
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error&) {
+        // 문자열 열은 합계를 낼 수 없음
+    }
+
+    std::cout << "✓ test_group_by passed\n";
+}
+
+void test_sort_by() {
+    ParseOptions options;
+    options.mode = ParseMode::Mapped;
+    options.infer_types = true;
+    CSVParser parser;
+    parser.parse("tests/test_data.csv", options);
+
+    // Int64 열 오름차순 (기수 정렬), 다른 열도 같이 움직임
+    parser.sortBy("age");
+    assert(parser.getInt(0, 1) == 22);
+    assert(parser.get(0, 0) == "Charlie");
+    assert(parser.get(4, 0) == "Eve");
+    assert(parser.table().column(0).isBorrowed());  // 셀은 복사하지 않음
+
+    // Double 열 내림차순
+    parser.sortBy("score", SortOrder::Descending);
+    assert(parser.get(0, 0) == "Alice");
+    assert(parser.getDouble(4, 3) == 87.5);
+
+    // 문자열 열
+    parser.sortBy("city");
+    assert(parser.get(0, 2) == "Busan");
+    assert(parser.get(4, 2) == "Seoul");
+
+    // 큰 표: 여러 키 안정 정렬, 여러 스레드 병합 정렬 결과가 같아야 함
+    const char* path = "tests/test_large_cpp.csv";
+    {
+        std::ofstream out(path);
+        out << "city,id,score\n";
+        const char* cities[] = {"Seoul", "Busan", "Incheon", "Daegu"};
+        for (int i = 0; i < 200000; ++i) {
+            out << cities[(i * 7) % 4] << "," << i << "," << ((i * 37) % 1000) - 500 << "\n";
+        }
+    }
+    CSVParser large;
+    large.parse(path, options);
+    const std::vector<SortKey> keys = {{"city"}, {"score", SortOrder::Descending}};
+    std::vector<uint32_t> single = large.table().sortOrder(keys);
+    std::vector<uint32_t> multi = large.table().sortOrder(keys, 4);
+    assert(single == multi);
+
+    large.sortBy(keys, 4);
+    for (size_t row = 1; row < large.rowCount(); ++row) {
+        const std::string_view prev_city = large.table().column(0)[row - 1];
+        const std::string_view city = large.table().column(0)[row];
+        assert(prev_city <= city);
+        if (prev_city == city) {
+            const int64_t prev_score = large.getInt(row - 1, 2);
+            const int64_t score = large.getInt(row, 2);
+            assert(prev_score >= score);
+            if (prev_score == score) {
+                assert(large.getInt(row - 1, 1) < large.getInt(row, 1));  // 원래 순서 유지
+            }
+        }
+    }
+    std::remove(path);
+
+    try {
+        parser.sortBy("missing");
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error&) {
+        // 없는 열
+    }
+
+    std::cout << "✓ test_sort_by passed\n";
+}
+
+void test_follow() {
+    const char* path = "tests/test_follow.csv";
+    {
+        std::ofstream out(path);
+        out << "name,age\nAlice,25\nBob,30\nCar";  // 마지막 줄은 쓰는 중
+    }
+    ParseOptions options;
+    options.infer_types = true;
+    CSVParser parser;
+    parser.follow(path, options);
+    assert(parser.isFollowing());
+    assert(parser.rowCount() == 2);
+    assert(parser.table().column(1).type() == ColumnType::Int64);
+
+    // 덧붙인 부분만 읽음 (여러 줄 따옴표 필드가 덜 써졌으면 기다림)
+    {
+        std::ofstream out(path, std::ios::app);
+        out << "ol,41\n\"Dan\nKim\",3";
+    }
+    RefreshResult result = parser.refresh();
+    assert(!result.reloaded);
+    assert(result.rows == 1);
+    assert(parser.get(2, 0) == "Carol");
+    assert(parser.getInt(2, 1) == 41);  // 새 행도 Int64로 변환
+    {
+        std::ofstream out(path, std::ios::app);
+        out << "3\n";
+    }
+    result = parser.refresh();
+    assert(result.rows == 1);
+    assert(parser.get(3, 0) == "Dan\nKim");
+    assert(parser.refresh().rows == 0);
+
+    // 숫자가 아닌 값이 오면 문자열 열로 넓힘
+    {
+        std::ofstream out(path, std::ios::app);
+        out << "Eve,unknown\n";
+    }
+    parser.refresh();
+    assert(parser.rowCount() == 5);
+    assert(parser.table().column(1).type() == ColumnType::String);
+    assert(parser.get(1, 1) == "30");
+
+    // 잘림: 처음부터 다시
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "name,age\nZed,1\n";
+    }
+    result = parser.refresh();
+    assert(result.reloaded);
+    assert(result.rows == 1);
+    assert(parser.rowCount() == 1);
+    assert(parser.get(0, 0) == "Zed");
+
+    // 로테이션: 같은 경로에 새 파일 (크기가 더 커도 inode로 감지)
+    const char* rotated = "tests/test_follow_rotated.csv";
+    {
+        std::ofstream out(rotated);
+        out << "name,age\nAmy,7\nBen,8\nCal,9\n";
+    }
+    std::rename(rotated, path);
+    result = parser.refresh();
+    assert(result.reloaded);
+    assert(parser.rowCount() == 3);
+    assert(parser.get(0, 0) == "Amy");
+
+    // "\r"만 쓰는 줄 끝 (끝의 "\r"은 "\r\n"일 수 있으므로 다음 바이트를 기다림)
+    {
+        std::ofstream out(path, std::ios::trunc | std::ios::binary);
+        out << "name,age\rAmy,7\r\"Ben\rLee\",8\r";
+    }
+    CSVParser carriage;
+    carriage.follow(path);
+    assert(carriage.rowCount() == 1);
+    assert(carriage.get(0, 0) == "Amy");
+    {
+        std::ofstream out(path, std::ios::app | std::ios::binary);
+        out << "\nCal,9\r";
+    }
+    result = carriage.refresh();
+    assert(result.rows == 1);
+    assert(carriage.get(1, 0) == "Ben\rLee" && carriage.get(1, 1) == "8");
+    {
+        std::ofstream out(path, std::ios::app | std::ios::binary);
+        out << "Dan,10\r";
+    }
+    result = carriage.refresh();
+    assert(result.rows == 1);
+    assert(carriage.rowCount() == 3 && carriage.get(2, 0) == "Cal");
+    CSVParser whole;
+    whole.parse(path);
+    assert(whole.rowCount() == 4);
+
+    // 일반 parse()는 이어 읽기를 끝냄
+    parser.parse(path);
+    assert(!parser.isFollowing());
+    try {
+        parser.refresh();
+        assert(false && "Should have thrown exception");
+    } catch (const std::logic_error&) {
+        // follow() 중이 아님
+    }
+    std::remove(path);
+
+    std::cout << "✓ test_follow passed\n";
+}
+
+void test_parse_many() {
+    std::vector<std::string> paths;
+    for (int i = 0; i < 100; ++i) {
+        paths.push_back("tests/test_many_cpp_" + std::to_string(i) + ".csv");
+        std::ofstream out(paths.back());
+        if (i % 2 == 0) {
+            out << "id,name,score\n";
+            for (int row = 0; row < 10; ++row) {
+                out << i * 10 + row << ",\"user, " << i << "\"," << row << "\n";
+            }
+        } else {
+            // 열 순서가 다른 파일 (프로젝션으로만 합칠 수 있음)
+            out << "score,id,name\n";
+            for (int row = 0; row < 10; ++row) {
+                out << row << "," << i * 10 + row << ",user" << i << "\n";
+            }
+        }
+    }
+
+    ParseOptions options;
+    options.columns = {"id", "score"};
+    options.infer_types = true;
+    CSVParser parser;
+    parser.parseMany(paths, options);
+    assert(parser.rowCount() == 1000);
+    assert(parser.headers() == std::vector<std::string>({"id", "score"}));
+    for (size_t row = 0; row < parser.rowCount(); ++row) {
+        assert(parser.getInt(row, 0) == static_cast<int64_t>(row));  // 파일 순서대로
+        assert(parser.getInt(row, 1) == static_cast<int64_t>(row % 10));
+    }
+
+    // 여러 스레드로 파싱해도 같은 결과
+    options.threads = 4;
+    CSVParser parallel;
+    parallel.parseMany(paths, options);
+    assert(parallel.rowCount() == 1000);
+    assert(parallel.getInt(999, 0) == 999);
+
+    // 프로젝션 없이 헤더가 다르면 실패
+    try {
+        parser.parseMany({paths[0], paths[1]});
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error&) {
+        // 헤더 불일치
+    }
+
+    // 같은 헤더끼리는 그대로 이어 붙임 (따옴표 필드 포함)
+    parser.parseMany({paths[0], paths[2]});
+    assert(parser.rowCount() == 20);
+    assert(parser.get(10, 1) == "user, 2");
+
+    try {
+        parser.parseMany({paths[0], "nonexistent_file.csv"});
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error&) {
+        // 없는 파일
+    }
+
+    for (const auto& path : paths) {
+        std::remove(path.c_str());
+    }
+    std::cout << "✓ test_parse_many passed\n";
+}
+
+void test_dictionary_encoding() {
+    const char* path = "tests/test_large_cpp.csv";
+    {
+        std::ofstream out(path);
+        out << "id,city,dept,score\n";
+        const char* cities[] = {"Seoul", "Busan", "Incheon", "Daegu"};
+        for (int i = 0; i < 200000; ++i) {
+            out << i << "," << cities[(i * 7) % 4] << "," << (i % 2 == 0 ? "A" : "B") << "," << (i % 100) << "\n";
+        }
+    }
+    ParseOptions plain_options;
+    plain_options.infer_types = true;
+    plain_options.threads = 4;
+    CSVParser plain;
+    plain.parse(path, plain_options);
+
+    ParseOptions options = plain_options;
+    options.mode = ParseMode::Mapped;
+    options.dictionary_max_distinct = 16;
+    CSVParser parser;
+    parser.parse(path, options);
+
+    // 서로 다른 값이 적은 문자열 열만 사전 열이 됨 (숫자 열은 그대로)
+    const CSVTable::Column& city = parser.column("city");
+    assert(city.isDictionary());
+    assert(city.dictionarySize() == 4);
+    assert(city.dictionaryValue(0) == "Seoul");  // 처음 나온 순서
+    assert(city.codes().size() == 200000);
+    assert(!city.isBorrowed());
+    assert(!parser.column("id").isDictionary());
+    assert(parser.column("id").type() == ColumnType::Int64);
+    for (size_t row = 0; row < 200000; row += 997) {
+        assert(parser.getView(row, 1) == plain.getView(row, 1));
+    }
+
+    // 코드로 거른 결과가 셀 비교 결과와 같음
+    const std::vector<CSVPredicate> seoul_a = {CSVPredicate("city", CompareOp::Equal, "Seoul"),
+                                               CSVPredicate("dept", CompareOp::Equal, "A")};
+    std::vector<uint32_t> selected = parser.select(seoul_a);
+    assert(selected == plain.select(seoul_a));
+    assert(selected.size() == 50000);
+    assert(parser.select({CSVPredicate("city", CompareOp::Greater, "D")}) ==
+           plain.select({CSVPredicate("city", CompareOp::Greater, "D")}));
+
+    // 코드로 바로 묶은 결과가 해시로 묶은 결과와 같음
+    std::vector<GroupAggregate> aggregates = {{"score", AggregateOp::Sum}, {"city", AggregateOp::Count}};
+    for (size_t threads : {1, 4}) {
+        CSVTable expected = plain.groupBy({"city", "dept"}, aggregates, threads);
+        CSVTable grouped = parser.groupBy({"city", "dept"}, aggregates, threads);
+        assert(grouped.rowCount() == expected.rowCount());
+        CSVTable by_city = parser.groupBy({"city"}, aggregates, threads);
+        CSVTable expected_city = plain.groupBy({"city"}, aggregates, threads);
+        assert(by_city.rowCount() == 4);
+        for (size_t row = 0; row < 4; ++row) {
+            assert(by_city.get(row, 0) == expected_city.get(row, 0));
+            assert(by_city.getInt(row, 1) == expected_city.getInt(row, 1));
+            assert(by_city.getInt(row, 2) == expected_city.getInt(row, 2));
+        }
+        for (size_t row = 0; row < grouped.rowCount(); ++row) {
+            assert(grouped.get(row, 0) == expected.get(row, 0));
+            assert(grouped.get(row, 1) == expected.get(row, 1));
+            assert(grouped.getInt(row, 2) == expected.getInt(row, 2));
+        }
+    }
+
+    // 사전 순위로 정렬해도 문자열 정렬과 같은 순서
+    const std::vector<SortKey> keys = {{"city", SortOrder::Descending}, {"score"}};
+    assert(parser.table().sortOrder(keys) == plain.table().sortOrder(keys, 4));
+    parser.sortBy(keys);
+    assert(parser.column("city").isDictionary());
+    assert(parser.get(0, 1) == "Seoul");
+    assert(parser.get(199999, 1) == "Busan");
+
+    // 값이 한도보다 많으면 인코딩하지 않음
+    CSVTable::Column ids = parser.column("id");
+    assert(!ids.encodeDictionary(16));
+    ids.convert(ColumnType::String);
+    assert(!ids.encodeDictionary(16));
+    assert(!ids.isDictionary());
+
+    // 사전 열끼리 이어 붙이면 사전을 합치고, 셀을 추가하면 보통 열로 돌아감
+    CSVTable::Column left;
+    CSVTable::Column right;
+    for (const char* value : {"x", "y", "x"}) {
+        left.append(value);
+    }
+    for (const char* value : {"z", "x"}) {
+        right.append(value);
+    }
+    assert(left.encodeDictionary(8) && right.encodeDictionary(8));
+    left.appendColumn(std::move(right));
+    assert(left.isDictionary());
+    assert(left.dictionarySize() == 3);
+    assert(left.size() == 5 && left[3] == "z" && left[4] == "x");
+    left.append("w");
+    assert(!left.isDictionary());
+    assert(left.size() == 6 && left[2] == "x" && left[5] == "w");
+    std::remove(path);
+
+    // 이어 읽기: 새 행도 사전에 합치고, 한도를 넘으면 보통 열로 되돌림
+    const char* follow_path = "tests/test_follow.csv";
+    {
+        std::ofstream out(follow_path);
+        out << "city\nSeoul\nBusan\nSeoul\n";
+    }
+    ParseOptions follow_options;
+    follow_options.dictionary_max_distinct = 2;
+    CSVParser follower;
+    follower.follow(follow_path, follow_options);
+    assert(follower.column("city").isDictionary());
+    {
+        std::ofstream out(follow_path, std::ios::app);
+        out << "Busan\n";
+    }
+    follower.refresh();
+    assert(follower.column("city").isDictionary());
+    assert(follower.column("city").dictionarySize() == 2);
+    assert(follower.get(3, 0) == "Busan");
+    {
+        std::ofstream out(follow_path, std::ios::app);
+        out << "Daegu\n";
+    }
+    follower.refresh();
+    assert(!follower.column("city").isDictionary());
+    assert(follower.rowCount() == 5 && follower.get(4, 0) == "Daegu" && follower.get(2, 0) == "Seoul");
+    std::remove(follow_path);
+
+    std::cout << "✓ test_dictionary_encoding passed\n";
+}
+
+void test_lazy_mode() {
+    // 따옴표 안 줄바꿈, "\r\n", 빈 줄이 섞인 파일 (여러 구간으로 나누어 색인되도록 3 MiB 이상)
+    const char* path = "tests/test_large_cpp.csv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "id,name,note\r\n";
+        for (int i = 0; i < 120000; ++i) {
+            if (i % 97 == 0) {
+                out << i << ",\"user, " << i << "\",\"line1\nline2\"\n";
+            } else if (i % 89 == 0) {
+                out << i << ",user" << i << ",crlf\r\n\n";
+            } else {
+                out << i << ",user" << i << ",note " << i * 7 << " padding padding\n";
+            }
+        }
+    }
+    CSVParser eager;
+    eager.parse(path);
+
+    ParseOptions options;
+    options.mode = ParseMode::Lazy;
+    options.threads = 4;
+    options.lazy_cache_rows = 2;
+    CSVParser lazy;
+    lazy.parse(path, options);
+    assert(lazy.isLazy());
+    assert(lazy.rowCount() == eager.rowCount());
+    assert(lazy.headers() == eager.headers());
+    for (size_t row = 0; row < eager.rowCount(); row += 7) {
+        assert(lazy.getRow(row) == eager.getRow(row));
+    }
+    assert(lazy.get(97, 1) == "user, 97");
+    assert(lazy.getView(97, 2) == "line1\nline2");
+    assert(lazy.getView(89, 2) == "crlf");
+    assert(lazy.findColumn("note") == 2);
+
+    // 단일 스레드 색인도 같은 결과, 프로젝션은 행을 토큰화할 때 적용
+    options.threads = 1;
+    options.columns = {"note", "id"};
+    CSVParser projected;
+    projected.parse(path, options);
+    assert(projected.rowCount() == eager.rowCount());
+    assert(projected.headers() == (std::vector<std::string>{"note", "id"}));
+    assert(projected.get(194, 0) == "line1\nline2" && projected.get(194, 1) == "194");
+
+    // 열 단위 기능은 materialize() 뒤에만
+    try {
+        lazy.column("id");
+        assert(false && "Should have thrown exception");
+    } catch (const std::logic_error&) {
+        // 테이블이 아직 없음
+    }
+    try {
+        options.filters = {CSVPredicate("id", CompareOp::Equal, 1)};
+        projected.parse(path, options);
+        assert(false && "Should have thrown exception");
+    } catch (const std::invalid_argument&) {
+        // 조건 필터는 지연 파싱과 함께 쓸 수 없음
+    }
+
+    options = ParseOptions();
+    options.mode = ParseMode::Lazy;
+    options.infer_types = true;
+    lazy.parse(path, options);
+    lazy.materialize();
+    assert(!lazy.isLazy());
+    assert(lazy.rowCount() == eager.rowCount());
+    assert(lazy.column("id").type() == ColumnType::Int64);
+    assert(lazy.getInt(119999, 0) == 119999);
+    assert(lazy.get(97, 2) == "line1\nline2");
+
+    // 헤더만 있는 파일
+    {
+        std::ofstream out(path);
+        out << "a,b\n";
+    }
+    lazy.parse(path, ParseMode::Lazy);
+    assert(lazy.rowCount() == 0 && lazy.colCount() == 2);
+    std::remove(path);
+
+    std::cout << "✓ test_lazy_mode passed\n";
+}
+
+void test_row_index() {
+    const char* path = "tests/test_row_index_cpp.csv";
+    const std::string index_path = std::string(path) + ".idx";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "id,name,note\n";
+        for (int i = 0; i < 5000; ++i) {
+            if (i % 13 == 0) {
+                out << i << ",\"user, " << i << "\",\"line1\nline2\"\n";
+            } else if (i % 11 == 0) {
+                out << i << ",user" << i << ",crlf\r\n\n";
+            } else {
+                out << i << ",user" << i << ",note " << i << "\n";
+            }
+        }
+    }
+    CSVParser eager;
+    eager.parse(path);
+
+    // stride가 큰 묶음(kStartBatch 이상)과 작은 묶음 모두 확인
+    for (size_t stride : {size_t(1), size_t(3), size_t(64), size_t(4500)}) {
+        CSVParser::buildIndex(path, stride, 2);
+
+        ParseOptions options;
+        options.mode = ParseMode::Lazy;
+        options.lazy_cache_rows = 1;
+        CSVParser lazy;
+        lazy.parse(path, options);
+        assert(lazy.usesRowIndex());
+        assert(lazy.rowCount() == eager.rowCount());
+        for (size_t row = 0; row < eager.rowCount(); row += (stride == 1 ? 1 : 5)) {
+            assert(lazy.getRow(row) == eager.getRow(row));
+        }
+        assert(lazy.get(eager.rowCount() - 1, 0) == "4999");
+        assert(lazy.get(13, 2) == "line1\nline2");
+        assert(lazy.get(11, 2) == "crlf");
+
+        // 색인을 끄면 스캔
+        options.use_row_index = false;
+        lazy.parse(path, options);
+        assert(!lazy.usesRowIndex());
+    }
+
+    // 원본이 바뀌면 지문이 맞지 않아 색인을 무시하고 다시 스캔
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        out << "5000,late,row\n";
+    }
+    CSVParser stale;
+    stale.parse(path, ParseMode::Lazy);
+    assert(!stale.usesRowIndex());
+    assert(stale.rowCount() == eager.rowCount() + 1);
+    assert(stale.get(5000, 1) == "late");
+
+    // 손상된 색인도 무시
+    CSVParser::buildIndex(path, 16);
+    {
+        std::fstream index(index_path, std::ios::binary | std::ios::in | std::ios::out);
+        index.seekp(70);
+        index.put('\x7f');
+    }
+    stale.parse(path, ParseMode::Lazy);
+    assert(!stale.usesRowIndex());
+    assert(stale.get(4999, 0) == "4999");
+
+    try {
+        CSVParser::buildIndex(path, 0);
+        assert(false && "Should have thrown exception");
+    } catch (const std::invalid_argument&) {
+        // stride는 1 이상
+    }
+    std::remove(path);
+    std::remove(index_path.c_str());
+
+    std::cout << "✓ test_row_index passed\n";
+}
+
+void test_join() {
+    // 작은 표: 이름으로 도시 붙이기 (오른쪽이 작으므로 오른쪽을 해시, 결과는 왼쪽 행 순서)
+    CSVTable people({"name", "age"});
+    people.appendRow({"Alice", "30"});
+    people.appendRow({"Bob", "25"});
+    people.appendRow({"Carol", "41"});
+    people.appendRow({"Alice", "31"});
+    people.convertColumn(1, ColumnType::Int64);
+    CSVTable cities({"name", "city", "age"});
+    cities.appendRow({"Alice", "Seoul", "1"});
+    cities.appendRow({"Carol", "Busan", "2"});
+    cities.appendRow({"Carol", "Daegu", "3"});
+
+    CSVTable inner = people.join(cities, "name", "name");
+    assert(inner.headers() == (std::vector<std::string>{"name", "age", "city", "age_right"}));
+    assert(inner.rowCount() == 4);
+    assert(inner.get(0, 0) == "Alice" && inner.get(0, 2) == "Seoul");
+    assert(inner.get(1, 2) == "Busan" && inner.get(2, 2) == "Daegu");  // 맞는 행들의 순서
+    assert(inner.get(3, 1) == "31");
+    assert(inner.column("age").type() == ColumnType::Int64 && inner.getInt(3, 1) == 31);
+
+    JoinOptions options;
+    options.type = JoinType::Left;
+    options.right_columns = {"city"};
+    CSVTable left = people.join(cities, "name", "name", options);
+    assert(left.colCount() == 3 && left.rowCount() == 5);
+    assert(left.get(1, 0) == "Bob" && left.get(1, 2).empty());
+
+    // 사전 열 키, 빈 셀이 필요한 사전 열
+    cities.encodeDictionaries(8);
+    options.right_columns = {"city", "name"};
+    CSVTable encoded = people.join(cities, "name", "name", options);
+    assert(encoded.column("city").isDictionary());
+    assert(encoded.get(1, 2).empty() && encoded.get(1, 3).empty());
+    assert(encoded.get(2, 2) == "Busan" && encoded.get(2, 3) == "Carol");
+
+    // 큰 표: 정수 키, 여러 스레드의 결과가 단일 스레드와 같음
+    CSVTable orders({"id", "customer"});
+    for (int i = 0; i < 200000; ++i) {
+        const std::string id = std::to_string(i);
+        const std::string customer = std::to_string(i % 100000);
+        orders.appendRow({id, customer});
+    }
+    orders.convertColumn(1, ColumnType::Int64);
+    CSVTable customers({"customer", "label"});
+    for (int i = 0; i < 130000; ++i) {
+        const std::string customer = std::to_string(i);
+        const std::string label = "c" + std::to_string(i);
+        customers.appendRow({customer, label});
+    }
+    customers.convertColumn(0, ColumnType::Int64);
+
+    options = JoinOptions();
+    options.threads = 4;
+    CSVTable joined = orders.join(customers, "customer", "customer", options);
+    assert(joined.rowCount() == 200000);
+    for (size_t row = 0; row < joined.rowCount(); row += 997) {
+        assert(joined.get(row, 0) == std::to_string(row));
+        assert(joined.get(row, 2) == "c" + std::to_string(row % 100000));
+    }
+
+    // 왼쪽이 작으면 왼쪽을 해시: 짝 없는 왼쪽 행은 맨 뒤에 왼쪽 행 순서로 붙음
+    options.type = JoinType::Left;
+    CSVTable reversed = customers.join(orders, "customer", "customer", options);
+    assert(reversed.rowCount() == 200000 + 30000);
+    assert(reversed.get(0, 2) == "0" && reversed.get(1, 2) == "1");  // 오른쪽 행 순서
+    assert(reversed.get(200000, 0) == "100000" && reversed.get(200000, 2).empty());
+    assert(reversed.get(229999, 0) == "129999");
+    options.threads = 1;
+    CSVTable serial = customers.join(orders, "customer", "customer", options);
+    assert(serial.rowCount() == reversed.rowCount());
+    for (size_t row = 0; row < serial.rowCount(); row += 101) {
+        assert(serial.get(row, 0) == reversed.get(row, 0) && serial.get(row, 2) == reversed.get(row, 2));
+    }
+
+    // 파서끼리 조인, 없는 키 열
+    const char* path = "tests/test_join_cpp.csv";
+    {
+        std::ofstream out(path);
+        out << "name,city\nAlice,Seoul\nBob,Busan\n";
+    }
+    CSVParser a;
+    a.parse("tests/test_data.csv");
+    CSVParser b;
+    b.parse(path);
+    CSVTable from_parsers = a.join(b, a.headers()[0], "name");
+    assert(from_parsers.colCount() == a.colCount() + 1);
+    try {
+        a.join(b, "missing", "name");
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error&) {
+        // 키 열이 없음
+    }
+    std::remove(path);
+
+    std::cout << "✓ test_join passed\n";
+}
+
+void test_external_sort_group_by() {
+    // 뒤쪽 행에만 소수가 있는 점수 열: 묶음마다 타입이 달라도 결과는 메모리 안 정렬/집계와 같아야 함
+    const char* path = "tests/test_spill_cpp.csv";
+    const char* sorted_path = "tests/test_spill_sorted_cpp.csv";
+    const std::string temp_dir = "tests/spill_tmp";
+    {
+        std::ofstream out(path);
+        out << "id,city,key,amount,score\n";
+        const char* cities[] = {"Seoul", "Busan", "Incheon", "Daegu"};
+        for (int i = 0; i < 60000; ++i) {
+            out << i << "," << cities[(i * 7) % 4] << ",k" << (i * 7919LL) % 5000 << "," << (i * 37) % 1000 << ","
+                << (i % 50) - 25;
+            if (i > 40000 && i % 3 == 0) {
+                out << ".5";
+            }
+            out << "\n";
+        }
+    }
+    std::filesystem::remove_all(temp_dir);  // 중단된 이전 실행이 남긴 디렉터리
+    std::filesystem::create_directory(temp_dir);
+
+    SpillOptions options;
+    options.memory_budget = 1024 * 1024;  // 여러 구간 + 여러 번 병합
+    options.temp_dir = temp_dir;
+    options.infer_types = true;
+    const std::vector<SortKey> keys = {{"city"}, {"score", SortOrder::Descending}};
+    SpillStats stats = CSVParser::sortFile(path, sorted_path, keys, options);
+    assert(stats.rows == 60000);
+    assert(stats.chunks > 2 && stats.merge_passes > 1 && stats.spilled_bytes > 0);
+    assert(std::filesystem::is_empty(temp_dir));  // 임시 파일은 남지 않음
+
+    ParseOptions parse_options;
+    parse_options.infer_types = true;
+    CSVParser memory;
+    memory.parse(path, parse_options);
+    memory.sortBy(keys);
+    {
+        CSVReader sorted(sorted_path);
+        assert(sorted.headers() == memory.headers());
+        size_t row = 0;
+        for (const auto& cells : sorted) {
+            assert(cells[0] == memory.get(row, 0));  // 안정 정렬: 같은 키는 원래 순서
+            ++row;
+        }
+        assert(row == 60000);
+    }
+
+    // 한 묶음에 들어가면 디스크를 쓰지 않음
+    stats = CSVParser::sortFile(path, sorted_path, {{"id"}}, SpillOptions());
+    assert(stats.chunks == 1 && stats.merge_passes == 0 && stats.spilled_bytes == 0);
+
+    // 마지막 묶음에만 숫자가 아닌 키: 한도와 관계없이 메모리 안 infer()처럼 문자열로 비교
+    const char* mixed_path = "tests/test_spill_mixed_cpp.csv";
+    {
+        std::ofstream out(mixed_path);
+        out << "id,key,pad\n";
+        for (int i = 0; i < 60000; ++i) {
+            out << i << "," << (i * 7919LL) % 100000 << ",padding-padding-padding\n";
+        }
+        out << "60000,N/A,padding-padding-padding\n";
+    }
+    CSVParser mixed_memory;
+    mixed_memory.parse(mixed_path, parse_options);
+    assert(mixed_memory.column("key").type() == ColumnType::String);
+    mixed_memory.sortBy(std::vector<SortKey>{{"key"}});
+    for (size_t budget : {size_t(1024 * 1024), SpillOptions().memory_budget}) {
+        SpillOptions mixed_options = options;
+        mixed_options.memory_budget = budget;
+        stats = CSVParser::sortFile(mixed_path, sorted_path, {{"key"}}, mixed_options);
+        assert(stats.rows == 60001);
+        assert(budget == SpillOptions().memory_budget ? stats.chunks == 1 : stats.chunks > 2);
+        assert(std::filesystem::is_empty(temp_dir));
+        CSVReader sorted(sorted_path);
+        size_t row = 0;
+        for (const auto& cells : sorted) {
+            assert(cells[0] == mixed_memory.get(row, 0));
+            assert(cells[1] == mixed_memory.get(row, 1));  // 원래 텍스트
+            ++row;
+        }
+        assert(row == 60001);
+    }
+    std::remove(mixed_path);
+
+    // 그룹이 많아 부분 집계가 한도를 넘으면 키 해시 파일로 나눔
+    const std::vector<GroupAggregate> aggregates = {
+        {"amount", AggregateOp::Sum}, {"amount", AggregateOp::Mean}, {"city", AggregateOp::Count},
+        {"score", AggregateOp::Min}, {"score", AggregateOp::Max}};
+    CSVParser grouped_input;
+    grouped_input.parse(path);
+    CSVTable expected = grouped_input.table();
+    expected.convertColumn(expected.findColumn("amount"), ColumnType::Int64);
+    expected.convertColumn(expected.findColumn("score"), ColumnType::Double);
+    for (const std::vector<std::string>& group_keys :
+         {std::vector<std::string>{"key"}, std::vector<std::string>{"city", "key"}, std::vector<std::string>{"city"}}) {
+        CSVTable in_memory = expected.groupBy(group_keys, aggregates);
+        CSVTable external = CSVParser::groupByFile(path, group_keys, aggregates, options, &stats);
+        assert(stats.rows == 60000 && stats.chunks > 2);
+        assert(group_keys.size() == 1 && group_keys[0] == "city" ? stats.spilled_bytes == 0 : stats.spilled_bytes > 0);
+        assert(std::filesystem::is_empty(temp_dir));
+        assert(external.headers() == in_memory.headers());
+        assert(external.rowCount() == in_memory.rowCount());
+        const size_t k = group_keys.size();
+        for (size_t row = 0; row < external.rowCount(); ++row) {
+            for (size_t col = 0; col < k; ++col) {
+                assert(external.get(row, col) == in_memory.get(row, col));  // 처음 나온 순서
+            }
+            assert(external.getInt(row, k) == in_memory.getInt(row, k));
+            assert(std::abs(external.getDouble(row, k + 1) - in_memory.getDouble(row, k + 1)) < 1e-9);
+            assert(external.getInt(row, k + 2) == in_memory.getInt(row, k + 2));
+            assert(std::stod(std::string(external.get(row, k + 3))) == in_memory.getDouble(row, k + 3));
+            assert(std::stod(std::string(external.get(row, k + 4))) == in_memory.getDouble(row, k + 4));
+        }
+    }
+
+    try {
+        CSVParser::groupByFile(path, {"city"}, {{"city", AggregateOp::Sum}}, options);
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error&) {
+        // 문자열 열은 합계를 낼 수 없음
+    }
+    try {
+        CSVParser::sortFile(path, sorted_path, {{"missing"}}, options);
+        assert(false && "Should have thrown exception");
+    } catch (const std::runtime_error&) {
+        // 없는 열
+    }
+    std::filesystem::remove_all(temp_dir);
+    std::remove(path);
+    std::remove(sorted_path);
+
+    std::cout << "✓ test_external_sort_group_by passed\n";
+}
+
+// 셀 전체를 std::from_chars로 읽은 기준값
+template <typename T>
+bool referenceParse(std::string_view text, T& value) {
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+// 성공 여부와 값(실수는 비트)이 기준과 같은지
+bool sameAsReference(std::string_view text) {
+    double expected = 0.0;
+    double actual = 0.0;
+    const bool expected_ok = referenceParse(text, expected);
+    if (parseDouble(text, actual) != expected_ok ||
+        (expected_ok && std::memcmp(&expected, &actual, sizeof(double)) != 0)) {
+        return false;
+    }
+    int64_t expected_int = 0;
+    int64_t actual_int = 0;
+    const bool expected_int_ok = referenceParse(text, expected_int);
+    return parseInt64(text, actual_int) == expected_int_ok && (!expected_int_ok || expected_int == actual_int);
+}
+
+void test_number_parsing() {
+    // 빠른 경로 경계와 느린 경로로 넘어가는 형식
+    const char* cases[] = {
+        "0", "-0", "7", "87.5", "-12.25", "12345678", "123456789", "-9223372036854775808",
+        "9223372036854775807", "9223372036854775808", "99999999999999999999", "0000000000000000000000012",
+        "1.", ".5", "-.5", ".", "-", "", "+1", " 1", "1 ", "1.5.3", "1e5", "1E+05", "2.5e-3", "1e", "1e+",
+        "1e400", "1e-400", "5e-324", "9007199254740993", "0.1", "0.30000000000000004", "123456.7e22",
+        "1.7976931348623157e308", "4.9406564584124654e-324", "inf", "-nan", "0x10", "1_0", "12a", "a12",
+        // Eisel–Lemire: 17자리, 중간값, 범위 끝, 비정규 수로 넘어가는 경계
+        "0.10000000000000001", "2.2250738585072014e-308", "2.2250738585072011e-308", "1e23", "9007199254740993e0",
+        "7.2057594037927933e16", "18446744073709551615", "1.7976931348623158e308", "1.7976931348623159e308",
+        "1e-342", "1e-343", "9999999999999999999e-360", "1e308", "1e309", "-8.98846567431158e307",
+    };
+    for (const char* text : cases) {
+        assert(sameAsReference(text));
+    }
+
+    double value = 0.0;
+    assert(parseDouble("87.5", value) && value == 87.5);
+    assert(parseDouble("-0", value) && std::signbit(value));
+    int64_t integer = 0;
+    assert(parseInt64("-9223372036854775808", integer) && integer == INT64_MIN);
+    assert(!parseInt64("9223372036854775808", integer));
+
+    // 무작위 셀: 짧은 소수, 지수, 자릿수가 많은 수, 섞인 글자 (버퍼 중간의 뷰)
+    std::string buffer;
+    std::vector<std::pair<size_t, size_t>> spans;
+    uint64_t seed = 2024;
+    auto next = [&seed]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return seed >> 17;
+    };
+    const char alphabet[] = "0123456789012345678901234567890123456789.-eE+x";
+    for (int i = 0; i < 200000; ++i) {
+        char cell[64];
+        int length = 0;
+        switch (i % 4) {
+            case 0:
+                length = std::snprintf(cell, sizeof(cell), "%s%llu.%0*llu", (next() % 2) ? "-" : "",
+                                       static_cast<unsigned long long>(next() % 100000000000ULL >> (next() % 36)),
+                                       static_cast<int>(next() % 10),
+                                       static_cast<unsigned long long>(next() % 1000000));
+                break;
+            case 1: {
+                double random = 0.0;
+                const uint64_t bits = next() * next();
+                std::memcpy(&random, &bits, sizeof(random));
+                length = std::snprintf(cell, sizeof(cell), "%.*g", static_cast<int>(next() % 19), random);
+                break;
+            }
+            case 2:
+                length = std::snprintf(cell, sizeof(cell), "%lld",
+                                       static_cast<long long>(next() >> (next() % 47)) * ((next() % 2) ? 1 : -1));
+                break;
+            default:
+                length = static_cast<int>(next() % 16);
+                for (int j = 0; j < length; ++j) {
+                    cell[j] = alphabet[next() % (sizeof(alphabet) - 1)];
+                }
+                break;
+        }
+        spans.emplace_back(buffer.size(), static_cast<size_t>(length));
+        buffer.append(cell, static_cast<size_t>(length));
+        buffer.push_back('9');  // 뷰 바로 뒤에 숫자가 있어도 셀 밖은 읽지 않음
+    }
+    // 무작위 double을 17자리로 (Clinger 범위 밖이 대부분)
+    for (int i = 0; i < 100000; ++i) {
+        double random = 0.0;
+        const uint64_t bits = next() * next();
+        std::memcpy(&random, &bits, sizeof(random));
+        char cell[64];
+        const int length = std::snprintf(cell, sizeof(cell), "%.17g", random);
+        assert(sameAsReference(std::string_view(cell, static_cast<size_t>(length))));
+    }
+
+    std::vector<std::string_view> cells;
+    for (const auto& span : spans) {
+        cells.emplace_back(buffer.data() + span.first, span.second);
+    }
+    for (std::string_view cell : cells) {
+        assert(sameAsReference(cell));
+    }
+
+    // 여러 셀 한 번에: 처음 실패한 위치를 반환
+    const std::vector<std::string_view> scores = {"87.5", "92", "-3.25", "1e3"};
+    std::vector<double> doubles(scores.size());
+    assert(parseDoubles(scores.data(), scores.size(), doubles.data()) == scores.size());
+    assert(doubles[0] == 87.5 && doubles[2] == -3.25 && doubles[3] == 1000.0);
+    std::vector<int64_t> ints(scores.size());
+    assert(parseInt64s(scores.data(), scores.size(), ints.data()) == 0);
+    assert(parseInt64s(scores.data() + 1, 1, ints.data()) == 1 && ints[0] == 92);
+
+    // 열 타입 변환도 같은 커널
+    CSVTable table({"score"});
+    for (size_t i = 0; i < 1000; ++i) {
+        table.appendRow({cells[i * 4]});
+    }
+    assert(table.convertColumn(0, ColumnType::Double));
+    for (size_t i = 0; i < 1000; ++i) {
+        double expected = 0.0;
+        referenceParse(cells[i * 4], expected);
+        assert(std::memcmp(&expected, &table.column(0).doubles()[i], sizeof(double)) == 0);
+    }
+
+    std::cout << "✓ test_number_parsing passed\n";
+}
+
 int main() {
     std::cout << "Running CSVParser C++ tests...\n\n";
 
@@ -95,6 +1659,28 @@ int main() {
     test_write();
     test_invalid_file();
     test_out_of_range();
+    test_mapped_mode();
+    test_materialize();
+    test_quoted_fields();
+    test_parallel_parse();
+    test_streaming_reader();
+    test_columnar_table();
+    test_type_inference();
+    test_projection();
+    test_filter();
+    test_snapshot();
+    test_buffered_writer();
+    test_aggregate();
+    test_group_by();
+    test_sort_by();
+    test_follow();
+    test_parse_many();
+    test_dictionary_encoding();
+    test_lazy_mode();
+    test_row_index();
+    test_join();
+    test_external_sort_group_by();
+    test_number_parsing();
 
     std::cout << "\n✓ All CSVParser tests passed!\n";
     return 0;
@@ -1,6 +1,9 @@
 #include <stdio.h>
 #include <assert.h>
+#include <math.h>
+#include <stdint.h>
 #include "mylib/calculator.h"
+#include "mylib/reduce.h"
 
 /* 간단한 테스트 프레임워크 (Unity 대체) */
 static int tests_run = 0;
@@ -92,6 +95,50 @@ void test_average_zero_size(void) {
     TEST_ASSERT_DOUBLE_WITHIN(0.01, 0.0, result, "average of size 0 should be 0.0");
 }
 
+/* SIMD 리덕션 커널을 단순 반복과 비교 (블록 경계와 꼬리 포함) */
+void test_reduce_matches_naive(void) {
+    int ints[67];
+    int64_t longs[67];
+    double doubles[67];
+    unsigned seed = 777;
+    for (size_t i = 0; i < 67; i++) {
+        seed = seed * 1103515245u + 12345u;
+        ints[i] = (int)(seed >> 8) - (1 << 23);
+        longs[i] = (int64_t)ints[i] * 1000003;
+        doubles[i] = ints[i] / 8.0;  /* 정확히 표현되는 값이라 합계 순서와 무관 */
+    }
+
+    int all_match = 1;
+    for (size_t n = 0; n <= 67; n++) {
+        long long sum = 0;
+        int64_t lmin = INT64_MAX, lmax = INT64_MIN;
+        double dmin = INFINITY, dmax = -INFINITY, dsum = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            sum += ints[i];
+            lmin = longs[i] < lmin ? longs[i] : lmin;
+            lmax = longs[i] > lmax ? longs[i] : lmax;
+            dmin = doubles[i] < dmin ? doubles[i] : dmin;
+            dmax = doubles[i] > dmax ? doubles[i] : dmax;
+            dsum += doubles[i];
+        }
+
+        ReduceInt64 li;
+        ReduceDouble di;
+        reduce_int64(longs, n, &li);
+        reduce_double(doubles, n, &di);
+        all_match = all_match && reduce_sum_int(ints, n) == sum &&
+                    li.sum == sum * 1000003 && li.min == lmin && li.max == lmax && li.count == n &&
+                    di.sum == dsum && di.min == dmin && di.max == dmax && di.count == n;
+    }
+    printf("(reduce backend: %s)\n", reduce_backend());
+    TEST_ASSERT(all_match, "SIMD reductions should match the naive loop for every length");
+
+    double with_nan[5] = { 3.0, NAN, -1.0, 7.0, 2.0 };
+    ReduceDouble di;
+    reduce_double(with_nan, 5, &di);
+    TEST_ASSERT(di.min == -1.0 && di.max == 7.0, "NaN should be skipped by min/max");
+}
+
 int main(void) {
     printf("=== Running Calculator Tests ===\n\n");
 
@@ -103,6 +150,7 @@ int main(void) {
     test_average_normal_array();
     test_average_null_array();
     test_average_zero_size();
+    test_reduce_matches_naive();
 
     printf("\n=== Test Results ===\n");
     printf("Tests run: %d\n", tests_run);
@@ -1,6 +1,8 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "mylib/csv_parser.h"
+#include "mylib/csv_read_files.h"
 
 /* 간단한 테스트 프레임워크 */
 static int tests_run = 0;
@@ -207,6 +209,488 @@ void test_nonexistent_file(void) {
     TEST_ASSERT(data == NULL, "csv_parse with nonexistent file should return NULL");
 }
 
+/* 큰 테스트 파일 생성 (따옴표 안의 쉼표/줄바꿈 포함) */
+static int write_large_csv(const char *path, size_t rows) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        return -1;
+    }
+    fprintf(file, "id,name,note\n");
+    for (size_t i = 0; i < rows; i++) {
+        if (i % 97 == 0) {
+            fprintf(file, "%zu,\"user, %zu\",\"line1\nline2\"\n", i, i);
+        } else {
+            fprintf(file, "%zu,user%zu,note %zu\n", i, i, i * 7);
+        }
+    }
+    fclose(file);
+    return 0;
+}
+
+/* 멀티스레드 파싱 테스트 */
+void test_parse_parallel(void) {
+    const char *path = "tests/test_large.csv";
+    if (write_large_csv(path, 20000) != 0) {
+        printf("SKIP: test_parse_parallel (cannot write file)\n");
+        return;
+    }
+
+    CSVData *single = csv_parse_parallel(path, 1);
+    CSVData *multi = csv_parse_parallel(path, 4);
+    TEST_ASSERT(single != NULL && multi != NULL, "csv_parse_parallel should return non-NULL");
+
+    if (single != NULL && multi != NULL) {
+        TEST_ASSERT_EQUAL_SIZE(20000, csv_row_count(multi), "Parallel parse should keep every row");
+        TEST_ASSERT_EQUAL_SIZE(3, csv_col_count(multi), "Parallel parse should have 3 columns");
+
+        int same = (csv_row_count(single) == csv_row_count(multi));
+        for (size_t i = 0; same && i < csv_row_count(multi); i++) {
+            for (size_t j = 0; j < 3; j++) {
+                if (strcmp(csv_get(single, i, j), csv_get(multi, i, j)) != 0) {
+                    same = 0;
+                    break;
+                }
+            }
+        }
+        TEST_ASSERT(same, "Parallel parse should match single-threaded parse in row order");
+        TEST_ASSERT_STRING_EQUAL("line1\nline2", csv_get(multi, 194, 2),
+                                 "Quoted newline should stay inside the field");
+    }
+
+    csv_destroy(single);
+    csv_destroy(multi);
+    remove(path);
+
+    CSVData *small = csv_parse_parallel("tests/test_data.csv", 0);
+    TEST_ASSERT(small != NULL, "csv_parse_parallel should parse small files");
+    if (small != NULL) {
+        TEST_ASSERT_EQUAL_SIZE(5, csv_row_count(small), "Small file should have 5 rows");
+        TEST_ASSERT_STRING_EQUAL("Gwangju", csv_get(small, 4, 2), "Row 4, Col 2 should be 'Gwangju'");
+        csv_destroy(small);
+    }
+    TEST_ASSERT(csv_parse_parallel("nonexistent_file.csv", 2) == NULL,
+                "csv_parse_parallel with nonexistent file should return NULL");
+}
+
+/* 스트리밍 콜백: 행 수와 나이 합계를 셈 */
+typedef struct {
+    size_t rows;
+    long age_sum;
+    size_t stop_after;
+} StreamStats;
+
+static int count_rows(char **fields, size_t field_count, void *user) {
+    StreamStats *stats = (StreamStats *)user;
+    stats->rows++;
+    if (field_count > 1) {
+        stats->age_sum += atol(fields[1]);
+    }
+    return (stats->stop_after > 0 && stats->rows >= stats->stop_after) ? 1 : 0;
+}
+
+/* 스트리밍 파싱 테스트 */
+void test_parse_stream(void) {
+    StreamStats stats = { 0, 0, 0 };
+    int status = csv_parse_stream("tests/test_data.csv", count_rows, &stats);
+    TEST_ASSERT_EQUAL_INT(0, status, "csv_parse_stream should read to the end");
+    TEST_ASSERT_EQUAL_SIZE(5, stats.rows, "Callback should see 5 data rows");
+    TEST_ASSERT(stats.age_sum == 140, "Sum of ages should be 140");
+
+    StreamStats early = { 0, 0, 2 };
+    status = csv_parse_stream("tests/test_data.csv", count_rows, &early);
+    TEST_ASSERT_EQUAL_INT(1, status, "Callback should be able to stop the stream");
+    TEST_ASSERT_EQUAL_SIZE(2, early.rows, "Stream should stop after 2 rows");
+
+    TEST_ASSERT_EQUAL_INT(-1, csv_parse_stream("nonexistent_file.csv", count_rows, &stats),
+                          "csv_parse_stream with nonexistent file should fail");
+
+    CSVStream *stream = csv_stream_open("tests/test_data.csv");
+    TEST_ASSERT(stream != NULL, "csv_stream_open should return non-NULL");
+    if (stream != NULL) {
+        size_t header_count = 0;
+        char **headers = csv_stream_headers(stream, &header_count);
+        TEST_ASSERT_EQUAL_SIZE(4, header_count, "Stream should expose 4 headers");
+        TEST_ASSERT_STRING_EQUAL("score", headers[3], "Fourth stream header should be 'score'");
+
+        char **fields;
+        size_t count;
+        TEST_ASSERT(csv_stream_next(stream, &fields, &count) == 1, "First stream row should be read");
+        TEST_ASSERT_STRING_EQUAL("Alice", fields[0], "First stream row should be Alice");
+        csv_stream_close(stream);
+    }
+}
+
+/* 스트림 버퍼보다 긴 행 테스트 */
+void test_stream_long_row(void) {
+    const char *path = "tests/test_long_row.csv";
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        printf("SKIP: test_stream_long_row (cannot write file)\n");
+        return;
+    }
+    fprintf(file, "id,blob\n1,");
+    for (int i = 0; i < 200000; i++) {
+        fputc('x', file);
+    }
+    fprintf(file, "\n2,short");
+    fclose(file);
+
+    CSVStream *stream = csv_stream_open(path);
+    TEST_ASSERT(stream != NULL, "Stream should open long-row file");
+    if (stream != NULL) {
+        char **fields;
+        size_t count;
+        TEST_ASSERT(csv_stream_next(stream, &fields, &count) == 1, "Long row should be read");
+        TEST_ASSERT_EQUAL_SIZE(200000, strlen(fields[1]), "Long field should not be truncated");
+        TEST_ASSERT(csv_stream_next(stream, &fields, &count) == 1, "Row after long row should be read");
+        TEST_ASSERT_STRING_EQUAL("short", fields[1], "Last field without newline should be read");
+        TEST_ASSERT(csv_stream_next(stream, &fields, &count) == 0, "Stream should end");
+        csv_stream_close(stream);
+    }
+    remove(path);
+}
+
+/* 블록 크기(1 MiB)보다 긴 행과 따옴표 안 줄바꿈을 csv_parse로 읽기 */
+void test_parse_long_line(void) {
+    const char *path = "tests/test_long_row.csv";
+    const size_t blob_length = 3 * 1024 * 1024 / 2;
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        printf("SKIP: test_parse_long_line (cannot write file)\n");
+        return;
+    }
+    fprintf(file, "id,blob,note\n1,\"{");
+    for (size_t i = 0; i < blob_length; i++) {
+        fputc('a' + (int)(i % 26), file);
+    }
+    fprintf(file, "}\",end\r\n2,\"multi\nline\",x\n3,short,y");
+    fclose(file);
+
+    CSVData *data = csv_parse(path);
+    TEST_ASSERT(data != NULL, "csv_parse should read lines longer than one block");
+    if (data != NULL) {
+        TEST_ASSERT_EQUAL_SIZE(3, csv_row_count(data), "Long line should not be split into extra rows");
+        const char *blob = csv_get(data, 0, 1);
+        TEST_ASSERT(blob != NULL && strlen(blob) == blob_length + 2, "Long field should not be truncated");
+        TEST_ASSERT(blob != NULL && blob[blob_length] == 'a' + (int)((blob_length - 1) % 26),
+                    "Long field should keep its tail");
+        TEST_ASSERT_STRING_EQUAL("end", csv_get(data, 0, 2), "Field after long field should be read");
+        TEST_ASSERT_STRING_EQUAL("multi\nline", csv_get(data, 1, 1), "Quoted newline should stay in the field");
+        TEST_ASSERT_STRING_EQUAL("y", csv_get(data, 2, 2), "Last row without newline should be read");
+        csv_destroy(data);
+    }
+    remove(path);
+}
+
+/* 프로젝션 파싱 테스트 */
+void test_parse_columns(void) {
+    const char *columns[] = { "score", "name" };
+    CSVData *data = csv_parse_columns("tests/test_data.csv", columns, 2);
+    TEST_ASSERT(data != NULL, "csv_parse_columns should return non-NULL");
+
+    if (data != NULL) {
+        TEST_ASSERT_EQUAL_SIZE(2, csv_col_count(data), "Projection should keep 2 columns");
+        TEST_ASSERT_EQUAL_SIZE(5, csv_row_count(data), "Projection should keep every row");
+        TEST_ASSERT_STRING_EQUAL("score", data->headers[0], "Projected headers should follow request order");
+        TEST_ASSERT_STRING_EQUAL("95.5", csv_get(data, 0, 0), "First projected cell should be score");
+        TEST_ASSERT_STRING_EQUAL("Eve", csv_get(data, 4, 1), "Second projected column should be name");
+
+        size_t col_index;
+        TEST_ASSERT_EQUAL_INT(-1, csv_find_column(data, "city", &col_index),
+                              "Skipped column should not be in the result");
+        csv_destroy(data);
+    }
+
+    const char *missing[] = { "name", "nope" };
+    TEST_ASSERT(csv_parse_columns("tests/test_data.csv", missing, 2) == NULL,
+                "Unknown projected column should fail");
+}
+
+/* 아레나 할당기 테스트 */
+void test_arena(void) {
+    CSVArena arena;
+    csv_arena_init(&arena);
+    TEST_ASSERT_EQUAL_SIZE(0, csv_arena_block_count(&arena), "New arena should have no blocks");
+
+    char *a = csv_arena_strndup(&arena, "hello", 5);
+    char *b = csv_arena_strndup(&arena, "world!", 5);
+    void **aligned = (void **)csv_arena_alloc(&arena, 4 * sizeof(void *), sizeof(void *));
+    TEST_ASSERT_STRING_EQUAL("hello", a, "Arena string copy should be NUL-terminated");
+    TEST_ASSERT_STRING_EQUAL("world", b, "Arena strndup should copy only the given length");
+    TEST_ASSERT(aligned != NULL && ((size_t)aligned % sizeof(void *)) == 0,
+                "Arena allocation should respect alignment");
+    TEST_ASSERT_EQUAL_SIZE(1, csv_arena_block_count(&arena), "Small allocations should share one block");
+
+    /* 큰 요청은 전용 블록으로 가고 현재 블록은 계속 사용 */
+    char *big = (char *)csv_arena_alloc(&arena, 1024 * 1024, 1);
+    TEST_ASSERT(big != NULL, "Large arena allocation should succeed");
+    memset(big, 'x', 1024 * 1024);
+    char *c = csv_arena_strndup(&arena, "again", 5);
+    TEST_ASSERT(c > b && c < b + 64, "Allocation after a large request should continue in the current block");
+    TEST_ASSERT_EQUAL_SIZE(2, csv_arena_block_count(&arena), "Large allocation should add one block");
+
+    CSVArena other;
+    csv_arena_init(&other);
+    char *moved = csv_arena_strndup(&other, "moved", 5);
+    csv_arena_merge(&arena, &other);
+    TEST_ASSERT_EQUAL_SIZE(3, csv_arena_block_count(&arena), "Merge should move blocks");
+    TEST_ASSERT_EQUAL_SIZE(0, csv_arena_block_count(&other), "Merged source should be empty");
+    TEST_ASSERT_STRING_EQUAL("moved", moved, "Merged allocations should stay valid");
+
+    csv_arena_free(&arena);
+    TEST_ASSERT_EQUAL_SIZE(0, csv_arena_block_count(&arena), "Freed arena should have no blocks");
+
+    /* 파싱 결과는 셀 수가 아니라 몇 개의 블록에 담김 */
+    const char *path = "tests/test_large.csv";
+    if (write_large_csv(path, 20000) == 0) {
+        CSVData *data = csv_parse_parallel(path, 4);
+        TEST_ASSERT(data != NULL, "Parallel parse for arena test should succeed");
+        if (data != NULL) {
+            TEST_ASSERT(csv_arena_block_count(&data->arena) < 64,
+                        "60000 cells should live in a few arena blocks");
+            csv_destroy(data);
+        }
+        remove(path);
+    }
+}
+
+void test_binary_snapshot(void) {
+    const char *path = "tests/test_snapshot.bin";
+    CSVData *data = csv_parse("tests/test_data.csv");
+    TEST_ASSERT(data != NULL, "csv_parse should succeed before snapshot");
+    if (data == NULL) {
+        return;
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, csv_save_binary(data, path), "csv_save_binary should succeed");
+    CSVData *loaded = csv_load_binary(path, 1);
+    TEST_ASSERT(loaded != NULL, "csv_load_binary should read the snapshot back");
+
+    if (loaded != NULL) {
+        TEST_ASSERT_EQUAL_SIZE(csv_row_count(data), csv_row_count(loaded), "Snapshot should keep row count");
+        TEST_ASSERT_EQUAL_SIZE(csv_col_count(data), csv_col_count(loaded), "Snapshot should keep col count");
+        int same = 1;
+        for (size_t r = 0; r < csv_row_count(data); r++) {
+            for (size_t c = 0; c < csv_col_count(data); c++) {
+                same = same && strcmp(csv_get(data, r, c), csv_get(loaded, r, c)) == 0;
+            }
+        }
+        TEST_ASSERT(same, "Snapshot cells should match the parsed cells");
+        TEST_ASSERT_STRING_EQUAL("city", loaded->headers[2], "Snapshot should keep headers");
+        csv_destroy(loaded);
+    }
+    csv_destroy(data);
+
+    /* 본문 한 바이트를 바꾸면 체크섬 검사에서 거부 */
+    FILE *file = fopen(path, "r+b");
+    if (file != NULL) {
+        fseek(file, -3, SEEK_END);
+        int byte = fgetc(file);
+        fseek(file, -3, SEEK_END);
+        fputc(byte ^ 0x5a, file);
+        fclose(file);
+    }
+    loaded = csv_load_binary(path, 1);
+    TEST_ASSERT(loaded == NULL, "Corrupted snapshot should be rejected when verifying");
+    csv_destroy(loaded);
+
+    TEST_ASSERT(csv_load_binary("tests/test_data.csv", 0) == NULL, "Plain CSV should not load as a snapshot");
+    remove(path);
+}
+
+void test_write_quoted(void) {
+    const char *path = "tests/test_large.csv";
+    if (write_large_csv(path, 2000) != 0) {
+        printf("SKIP: test_write_quoted (cannot write file)\n");
+        return;
+    }
+
+    CSVData *data = csv_parse(path);
+    TEST_ASSERT(data != NULL, "csv_parse should read quoted fields");
+    if (data == NULL) {
+        remove(path);
+        return;
+    }
+
+    /* 쉼표/줄바꿈이 든 셀은 따옴표로 감싸 다시 읽어도 같은 값 */
+    TEST_ASSERT_EQUAL_INT(0, csv_write(data, "tests/test_output.csv"), "csv_write should succeed");
+    CSVData *reread = csv_parse("tests/test_output.csv");
+    TEST_ASSERT(reread != NULL, "Written quoted file should parse");
+    if (reread != NULL) {
+        TEST_ASSERT_EQUAL_SIZE(csv_row_count(data), csv_row_count(reread), "Quoted rows should survive a round trip");
+        int same = csv_row_count(data) == csv_row_count(reread);
+        for (size_t r = 0; same && r < csv_row_count(data); r++) {
+            for (size_t c = 0; c < csv_col_count(data); c++) {
+                same = same && strcmp(csv_get(data, r, c), csv_get(reread, r, c)) == 0;
+            }
+        }
+        TEST_ASSERT(same, "Quoted cells should survive a round trip");
+        TEST_ASSERT_STRING_EQUAL("line1\nline2", csv_get(reread, 0, 2), "Embedded newline should be kept");
+        csv_destroy(reread);
+    }
+
+    csv_destroy(data);
+    remove(path);
+}
+
+/* 미리 읽기 리더: 블록 경계와 상관없이 파일 내용이 그대로 나와야 함 */
+void test_readahead(void) {
+    const char *path = "tests/test_readahead.bin";
+    const size_t size = 5 * 1024 * 1024 + 123;
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        printf("SKIP: test_readahead (cannot write file)\n");
+        return;
+    }
+    for (size_t i = 0; i < size; i++) {
+        fputc((int)((i * 31 + i / 4096) & 0xff), file);
+    }
+    fclose(file);
+
+    /* 작은 블록 + 얕은 링: 생산자가 여러 번 기다리게 만듦 */
+    CSVReadAhead *reader = csv_readahead_open(path, 64 * 1024, 3);
+    TEST_ASSERT(reader != NULL, "csv_readahead_open should open the file");
+    if (reader != NULL) {
+        char piece[10007];
+        size_t offset = 0;
+        int same = 1;
+        size_t n;
+        while ((n = csv_readahead_read(reader, piece, sizeof(piece))) > 0) {
+            for (size_t i = 0; i < n; i++) {
+                same &= ((unsigned char)piece[i] == (((offset + i) * 31 + (offset + i) / 4096) & 0xff));
+            }
+            offset += n;
+        }
+        TEST_ASSERT(same, "Read-ahead bytes should match the file");
+        TEST_ASSERT_EQUAL_SIZE(size, offset, "Read-ahead should read the whole file");
+        TEST_ASSERT_EQUAL_INT(0, csv_readahead_error(reader), "Read-ahead should not report an error");
+
+        CSVReadAheadStats stats;
+        csv_readahead_stats(reader, &stats);
+        TEST_ASSERT_EQUAL_INT(1, stats.threaded, "Large file should use the producer thread");
+        TEST_ASSERT(stats.bytes_read == size, "Stats should count every byte");
+        TEST_ASSERT(stats.blocks_read == (size + 64 * 1024 - 1) / (64 * 1024), "Stats should count blocks");
+        csv_readahead_close(reader);
+    }
+
+    /* 다 읽기 전에 닫아도 생산자가 멈춰야 함 */
+    reader = csv_readahead_open(path, 64 * 1024, 2);
+    if (reader != NULL) {
+        char piece[100];
+        TEST_ASSERT_EQUAL_SIZE(sizeof(piece), csv_readahead_read(reader, piece, sizeof(piece)),
+                               "Partial read should succeed");
+        csv_readahead_close(reader);
+    }
+    remove(path);
+
+    /* 블록 하나보다 작은 파일은 스레드 없이 읽음 */
+    reader = csv_readahead_open("tests/test_data.csv", 0, 0);
+    TEST_ASSERT(reader != NULL, "Small file should open");
+    if (reader != NULL) {
+        char buffer[256];
+        size_t n = csv_readahead_read(reader, buffer, sizeof(buffer));
+        TEST_ASSERT(n > 0 && n < sizeof(buffer), "Small file should be read at once");
+        TEST_ASSERT(strncmp(buffer, "name,age", 8) == 0, "Small file content should match");
+        CSVReadAheadStats stats;
+        csv_readahead_stats(reader, &stats);
+        TEST_ASSERT_EQUAL_INT(0, stats.threaded, "Small file should not start a thread");
+        csv_readahead_close(reader);
+    }
+    TEST_ASSERT(csv_readahead_open("tests/does_not_exist.csv", 0, 0) == NULL,
+                "Missing file should fail to open");
+}
+
+/* 스트림은 미리 읽기 리더로 읽고 통계를 제공 */
+void test_stream_readahead(void) {
+    const char *path = "tests/test_large.csv";
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        printf("SKIP: test_stream_readahead (cannot write file)\n");
+        return;
+    }
+    fprintf(file, "id,name,value\n");
+    for (int i = 0; i < 200000; i++) {
+        fprintf(file, "%d,\"name, %d\",%d\n", i, i, i * 3);
+    }
+    long size = ftell(file);
+    fclose(file);
+
+    CSVStream *stream = csv_stream_open(path);
+    TEST_ASSERT(stream != NULL, "Stream should open large file");
+    if (stream != NULL) {
+        char **fields;
+        size_t count;
+        int rows = 0;
+        int ordered = 1;
+        while (csv_stream_next(stream, &fields, &count) == 1) {
+            ordered &= (atoi(fields[0]) == rows && atoi(fields[2]) == rows * 3);
+            rows++;
+        }
+        TEST_ASSERT_EQUAL_INT(200000, rows, "Stream should read every row");
+        TEST_ASSERT(ordered, "Rows should come in file order");
+
+        CSVReadAheadStats stats;
+        TEST_ASSERT_EQUAL_INT(0, csv_stream_io_stats(stream, &stats), "csv_stream_io_stats should succeed");
+        TEST_ASSERT(stats.bytes_read == (uint64_t)size, "Stream should read the whole file once");
+        TEST_ASSERT_EQUAL_INT(1, stats.threaded, "Multi-block file should be read ahead");
+        csv_stream_close(stream);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, csv_stream_io_stats(NULL, NULL), "NULL stream should fail");
+    remove(path);
+}
+
+/* 여러 파일 한꺼번에 읽기: io_uring과 일반 읽기 결과가 같아야 함 */
+void test_read_files(void) {
+    enum { FILE_COUNT = 150 };  /* 묶음(64개) 경계를 넘도록 */
+    char names[FILE_COUNT + 1][64];
+    const char *paths[FILE_COUNT + 1];
+    for (int i = 0; i < FILE_COUNT; i++) {
+        snprintf(names[i], sizeof(names[i]), "tests/test_many_%d.csv", i);
+        paths[i] = names[i];
+        FILE *file = fopen(names[i], "w");
+        if (file == NULL) {
+            printf("SKIP: test_read_files (cannot write file)\n");
+            return;
+        }
+        fprintf(file, "id,value\n");
+        for (int row = 0; row < i; row++) {  /* 0번 파일은 헤더만 */
+            fprintf(file, "%d,%d\n", row, row * i);
+        }
+        fclose(file);
+    }
+    snprintf(names[FILE_COUNT], sizeof(names[FILE_COUNT]), "tests/does_not_exist.csv");
+    paths[FILE_COUNT] = names[FILE_COUNT];
+
+    CSVFileBuffer automatic[FILE_COUNT + 1];
+    CSVFileBuffer plain[FILE_COUNT + 1];
+    int failed_auto = csv_read_files(paths, FILE_COUNT + 1, automatic, CSV_READ_AUTO);
+    int failed_plain = csv_read_files(paths, FILE_COUNT + 1, plain, CSV_READ_PLAIN);
+    printf("  csv_read_files backend: %s\n", csv_read_files_backend());
+
+    TEST_ASSERT_EQUAL_INT(1, failed_auto, "Only the missing file should fail");
+    TEST_ASSERT_EQUAL_INT(1, failed_plain, "Only the missing file should fail (plain)");
+    TEST_ASSERT(automatic[FILE_COUNT].error != 0 && automatic[FILE_COUNT].data == NULL,
+                "Missing file should report an error");
+    int same = 1;
+    for (int i = 0; i < FILE_COUNT; i++) {
+        same &= (automatic[i].error == 0 && automatic[i].size == plain[i].size &&
+                 memcmp(automatic[i].data, plain[i].data, plain[i].size) == 0 &&
+                 automatic[i].data[automatic[i].size] == '\0');
+    }
+    TEST_ASSERT(same, "Batched reads should match plain reads");
+    TEST_ASSERT(strncmp(automatic[FILE_COUNT - 1].data, "id,value\n0,0\n1,149\n", 19) == 0,
+                "File content should be intact");
+
+    csv_file_buffers_free(automatic, FILE_COUNT + 1);
+    csv_file_buffers_free(plain, FILE_COUNT + 1);
+    TEST_ASSERT_EQUAL_INT(-1, csv_read_files(NULL, 1, NULL, CSV_READ_AUTO), "NULL arguments should fail");
+    TEST_ASSERT_EQUAL_INT(0, csv_read_files(NULL, 0, NULL, CSV_READ_AUTO), "Empty list should succeed");
+
+    for (int i = 0; i < FILE_COUNT; i++) {
+        remove(names[i]);
+    }
+}
+
 int main(void) {
     printf("=== Running CSV Parser Tests ===\n\n");
 
@@ -219,6 +703,17 @@ int main(void) {
     test_write_csv();
     test_null_pointer_safety();
     test_nonexistent_file();
+    test_parse_parallel();
+    test_parse_stream();
+    test_stream_long_row();
+    test_parse_long_line();
+    test_arena();
+    test_parse_columns();
+    test_binary_snapshot();
+    test_write_quoted();
+    test_readahead();
+    test_stream_readahead();
+    test_read_files();
 
     printf("\n=== Test Results ===\n");
     printf("Tests run: %d\n", tests_run);
@@ -0,0 +1,252 @@
+#include <stdio.h>
+#include <string.h>
+#include "mylib/csv_scan.h"
+#include "mylib/csv_tokenizer.h"
+
+/* 간단한 테스트 프레임워크 */
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST_ASSERT(condition, message) \
+    do { \
+        tests_run++; \
+        if (condition) { \
+            printf("PASS: %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("FAIL: %s\n", message); \
+        } \
+    } while(0)
+
+#define TEST_ASSERT_EQUAL_SIZE(expected, actual, message) \
+    do { \
+        tests_run++; \
+        if ((expected) == (actual)) { \
+            printf("PASS: %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("FAIL: %s (expected %zu, got %zu)\n", message, (size_t)expected, (size_t)actual); \
+        } \
+    } while(0)
+
+static int is_special(char c) {
+    return c == ',' || c == '"' || c == '\r' || c == '\n';
+}
+
+/* 필드 값을 NUL 종료 문자열로 복원 */
+static const char* field_text(const CSVRecord *rec, size_t index, char *buf) {
+    buf[csv_field_decode(&rec->fields[index], buf)] = '\0';
+    return buf;
+}
+
+/* 스캐너 결과를 바이트 단위 탐색과 비교 (블록 경계 및 꼬리 포함) */
+void test_scanner_matches_naive(void) {
+    char data[300];
+    unsigned seed = 12345;
+    for (size_t i = 0; i < sizeof(data); i++) {
+        seed = seed * 1103515245u + 12345u;
+        unsigned r = (seed >> 16) % 16;
+        data[i] = (r == 0) ? ',' : (r == 1) ? '"' : (r == 2) ? '\n' : (r == 3) ? '\r' : (char)('a' + r);
+    }
+
+    int all_match = 1;
+    for (size_t len = 0; len <= sizeof(data); len += 7) {
+        CSVScanner sc;
+        csv_scanner_init(&sc, data, len);
+        size_t expected = 0;
+        for (;;) {
+            while (expected < len && !is_special(data[expected])) {
+                expected++;
+            }
+            size_t actual = csv_scanner_next(&sc);
+            if (actual != expected) {
+                all_match = 0;
+                break;
+            }
+            if (expected >= len) {
+                break;
+            }
+            expected++;
+        }
+    }
+    TEST_ASSERT(all_match, "Scanner should report the same positions as a byte loop");
+}
+
+void test_scanner_seek(void) {
+    const char *text = "aaaa,bbbb,cccc";
+    CSVScanner sc;
+    csv_scanner_init(&sc, text, strlen(text));
+    csv_scanner_seek(&sc, 5);
+    TEST_ASSERT_EQUAL_SIZE(9, csv_scanner_next(&sc), "Seek should skip earlier delimiters");
+    TEST_ASSERT_EQUAL_SIZE(14, csv_scanner_next(&sc), "Scanner should return len at the end");
+
+    TEST_ASSERT_EQUAL_SIZE(3, csv_scan_special("abc\ndef", 7), "csv_scan_special should find newline");
+    TEST_ASSERT_EQUAL_SIZE(0, csv_scan_special(NULL, 0), "csv_scan_special on empty input returns 0");
+
+    const char *backend = csv_scan_backend();
+    TEST_ASSERT(backend != NULL && strcmp(backend, "unknown") != 0, "Backend should be resolved");
+    printf("INFO: scan backend = %s\n", backend);
+}
+
+void test_tokenizer_records(void) {
+    const char *text = "name,city\r\n\r\nAlice,\"Seoul, KR\"\nBob,Busan";
+    CSVTokenizer tok;
+    CSVRecord rec;
+    char buf[64];
+
+    csv_record_init(&rec);
+    csv_tokenizer_init(&tok, text, strlen(text), 1);
+
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 1, "First record should be read");
+    TEST_ASSERT_EQUAL_SIZE(2, rec.count, "Header should have 2 fields");
+    TEST_ASSERT(strcmp(field_text(&rec, 1, buf), "city") == 0, "CRLF should not leak into the field");
+
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 1, "Blank line should be skipped");
+    TEST_ASSERT_EQUAL_SIZE(2, rec.count, "Quoted comma should not split the field");
+    TEST_ASSERT(strcmp(field_text(&rec, 1, buf), "Seoul, KR") == 0, "Quotes should be removed");
+
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 1, "Last record without newline should be read");
+    TEST_ASSERT(strcmp(field_text(&rec, 0, buf), "Bob") == 0, "Last record first field");
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 0, "No more records at the end");
+
+    csv_record_free(&rec);
+}
+
+void test_tokenizer_partial_buffer(void) {
+    const char *text = "a,b\nc,d";
+    CSVTokenizer tok;
+    CSVRecord rec;
+
+    csv_record_init(&rec);
+    csv_tokenizer_init(&tok, text, strlen(text), 0);
+
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 1, "Complete record should be read");
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 0, "Cut-off record should wait for more data");
+    TEST_ASSERT_EQUAL_SIZE(4, tok.pos, "Consumed offset should point at the cut-off record");
+
+    csv_record_free(&rec);
+}
+
+void test_tokenizer_rfc4180(void) {
+    /* 따옴표 안의 구분자, "", CRLF, 빈 따옴표 필드 */
+    const char *text = "a,\"b \"\"x\"\", c\",\"line1\r\nline2\",\"\"\n\"\"\"\",ab\"c,d\"e\r\n";
+    CSVTokenizer tok;
+    CSVRecord rec;
+    char buf[64];
+
+    csv_record_init(&rec);
+    csv_tokenizer_init(&tok, text, strlen(text), 1);
+
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 1, "Record with quoted fields should be read");
+    TEST_ASSERT_EQUAL_SIZE(4, rec.count, "Quoted comma and CRLF should not split the record");
+    TEST_ASSERT(strcmp(field_text(&rec, 1, buf), "b \"x\", c") == 0, "Escaped quotes should become one quote");
+    TEST_ASSERT(strcmp(field_text(&rec, 2, buf), "line1\r\nline2") == 0, "Quoted CRLF should stay in the field");
+    TEST_ASSERT(strcmp(field_text(&rec, 3, buf), "") == 0, "Empty quoted field should be empty");
+
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 1, "Second record should be read");
+    TEST_ASSERT_EQUAL_SIZE(2, rec.count, "Second record should have 2 fields");
+    TEST_ASSERT(strcmp(field_text(&rec, 0, buf), "\"") == 0, "Four quotes should be one quote");
+    TEST_ASSERT(strcmp(field_text(&rec, 1, buf), "abc,de") == 0, "Quote inside an unquoted field opens a quoted run");
+    TEST_ASSERT(csv_tokenizer_next(&tok, &rec) == 0, "No more records at the end");
+
+    /* 제자리 복원 */
+    char in_place[] = "\"x\"\"y\"";
+    CSVField field = { in_place, strlen(in_place), 1 };
+    size_t length = csv_field_decode(&field, in_place);
+    TEST_ASSERT(length == 3 && memcmp(in_place, "x\"y", 3) == 0, "In-place decode should unescape quotes");
+
+    /* csv_field_encode()로 쓴 값은 토큰화와 복원 뒤 그대로 */
+    const char alphabet[] = { 'a', 'b', ',', '"', '\n', '\r', ' ' };
+    char values[300][8];
+    size_t lengths[300];
+    char encoded[300 * (CSV_FIELD_ENCODED_MAX(7) + 1)];
+    size_t len = 0;
+    unsigned seed = 777;
+    for (size_t i = 0; i < 300; i++) {
+        seed = seed * 1103515245u + 12345u;
+        lengths[i] = (seed >> 16) % 8;
+        for (size_t j = 0; j < lengths[i]; j++) {
+            seed = seed * 1103515245u + 12345u;
+            values[i][j] = alphabet[(seed >> 16) % sizeof(alphabet)];
+        }
+        len += csv_field_encode(values[i], lengths[i], encoded + len);
+        encoded[len++] = (i % 3 == 2) ? '\n' : ',';
+    }
+
+    int same = 1;
+    size_t records = 0;
+    csv_tokenizer_init(&tok, encoded, len, 1);
+    while (same && csv_tokenizer_next(&tok, &rec) == 1) {
+        same = rec.count == 3;
+        for (size_t j = 0; same && j < 3; j++) {
+            size_t i = records * 3 + j;
+            same = csv_field_decode(&rec.fields[j], buf) == lengths[i] && memcmp(buf, values[i], lengths[i]) == 0;
+        }
+        records++;
+    }
+    TEST_ASSERT(same && records == 100, "Encoded values should survive tokenize and decode");
+
+    csv_record_free(&rec);
+}
+
+void test_scan_record_starts(void) {
+    /* 따옴표 안 줄바꿈, "\r\n", 빈 줄이 64바이트 블록 경계에 걸치도록 반복 */
+    char data[4096];
+    size_t len = 0;
+    const char *pieces[] = { "a,b\n", "\"x\ny\",1\r\n", "\n\n", "plain,2\n", "\"q\"\"\n\",3\r", "z,4\n" };
+    for (int i = 0; len + 32 < sizeof(data); i++) {
+        const char *piece = pieces[(i * 5) % 6];
+        memcpy(data + len, piece, strlen(piece));
+        len += strlen(piece);
+    }
+
+    /* 기준: 바이트를 하나씩 보며 따옴표 밖 줄 끝 다음을 모음 */
+    uint64_t expected[4096];
+    size_t expected_count = 0;
+    int quoted = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] == '"') {
+            quoted = !quoted;
+        } else if (!quoted && (data[i] == '\n' || data[i] == '\r') && i + 1 < len &&
+                   data[i + 1] != '\n' && data[i + 1] != '\r') {
+            expected[expected_count++] = i + 1;
+        }
+    }
+
+    /* 작은 배열로 여러 번 나누어 불러도 같은 결과 */
+    uint64_t starts[4096];
+    size_t count = 0;
+    size_t pos = 0;
+    int in_quotes = 0;
+    while (pos < len) {
+        count += csv_scan_record_starts(data, len, &pos, &in_quotes, starts + count, 3);
+    }
+    TEST_ASSERT_EQUAL_SIZE(expected_count, count, "Record start count should match byte-wise scan");
+    TEST_ASSERT(memcmp(expected, starts, count * sizeof(uint64_t)) == 0,
+                "Record starts should match byte-wise scan");
+    TEST_ASSERT(in_quotes == 0, "Scan should end outside quotes");
+
+    /* 중간에서 시작: 따옴표 상태를 넘겨주면 이어서 찾음 */
+    pos = 5;
+    in_quotes = 1;
+    count = csv_scan_record_starts("a,b\n\"x\ny\",1\nz\n", 14, &pos, &in_quotes, starts, 8);
+    TEST_ASSERT(count == 1 && starts[0] == 12, "Scan should honor the initial quote state");
+}
+
+int main(void) {
+    printf("=== Running CSV Scan Tests ===\n\n");
+
+    test_scanner_matches_naive();
+    test_scanner_seek();
+    test_tokenizer_records();
+    test_tokenizer_partial_buffer();
+    test_tokenizer_rfc4180();
+    test_scan_record_starts();
+
+    printf("\n=== Test Results ===\n");
+    printf("Tests run: %d\n", tests_run);
+    printf("Tests passed: %d\n", tests_passed);
+    printf("Tests failed: %d\n", tests_run - tests_passed);
+
+    return (tests_run == tests_passed) ? 0 : 1;
+}